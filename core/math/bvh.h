@@ -53,6 +53,7 @@
 #include "bvh_tree.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -307,6 +308,22 @@ public:
 #endif
 	}
 
+	// Below this many changed items, update_threaded() runs the overlap queries on the calling thread.
+	static constexpr uint32_t THREADED_PAIRING_MIN_ITEMS = 128;
+
+	// Same as update(), but the overlap queries of the changed items run as a
+	// WorkerThreadPool group task. Pair and unpair callbacks are still sent from
+	// the calling thread in the same order as update(), so the resulting pairs
+	// don't depend on the number of threads.
+	void update_threaded() {
+		BVH_LOCKED_FUNCTION
+		tree.update();
+		_check_for_collisions_threaded();
+#ifdef BVH_INTEGRITY_CHECKS
+		tree._integrity_check_all();
+#endif
+	}
+
 	// this can be called more frequently than per frame if necessary
 	void update_collisions() {
 		BVH_LOCKED_FUNCTION
@@ -479,6 +496,64 @@ private:
 		_reset();
 	}
 
+	// Finds the overlaps of a single changed item, writing them to its own hit list.
+	// Only reads the tree, so it can run for several items at once.
+	void _find_changed_item_hits(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &changed_item_hits[p_index];
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		tree.cull_aabb(params, false);
+	}
+
+	void _check_for_collisions_threaded() {
+		uint32_t changed_count = changed_items.size();
+
+		// Dispatching tasks costs more than it saves for a handful of items.
+		if (changed_count < THREADED_PAIRING_MIN_ITEMS) {
+			_check_for_collisions();
+			return;
+		}
+
+		if (changed_item_hits.size() < changed_count) {
+			changed_item_hits.resize(changed_count);
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_find_changed_item_hits, (void *)nullptr, changed_count, -1, true, SNAME("BVHFindPairs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		// Pairing changes are applied in changed item order, as in _check_for_collisions().
+		for (uint32_t i = 0; i < changed_count; i++) {
+			const BVHHandle &h = changed_items[i];
+
+			BVHABB_CLASS abb;
+			abb.from(tree._pairs[h.id()].expanded_aabb);
+			_find_leavers(h, abb, false);
+
+			uint32_t changed_item_ref_id = h.id();
+
+			for (const uint32_t ref_id : changed_item_hits[i]) {
+				if (ref_id == changed_item_ref_id) {
+					continue;
+				}
+
+				BVHHandle h_collidee;
+				h_collidee.set_id(ref_id);
+				_collide(h, h_collidee);
+			}
+		}
+		_reset();
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -770,6 +845,8 @@ private:
 	// for collision pairing,
 	// maintain a list of all items moved etc on each frame / tick
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
+	// Per changed item overlaps, filled by update_threaded().
+	LocalVector<LocalVector<uint32_t, uint32_t, true>> changed_item_hits;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
 	class BVHLockedFunction {
@@ -0,0 +1,423 @@
+/**************************************************************************/
+/*  math_batch.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "math_batch.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_BATCH_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MATH_BATCH_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(MATH_BATCH_SSE2) || defined(MATH_BATCH_NEON)
+// Kernels working on single precision data, such as culling bounds.
+#define MATH_BATCH_SIMD
+#ifndef REAL_T_IS_DOUBLE
+// Kernels working on `real_t` math types.
+#define MATH_BATCH_SIMD_REAL
+#endif
+
+// Minimal 4-wide float abstraction, so each kernel is only written once.
+
+#ifdef MATH_BATCH_SSE2
+typedef __m128 f4;
+
+static _FORCE_INLINE_ f4 f4_load(const float *p_ptr) { return _mm_loadu_ps(p_ptr); }
+static _FORCE_INLINE_ void f4_store(float *p_ptr, f4 p_v) { _mm_storeu_ps(p_ptr, p_v); }
+static _FORCE_INLINE_ f4 f4_set(float p_x, float p_y, float p_z, float p_w) { return _mm_setr_ps(p_x, p_y, p_z, p_w); }
+static _FORCE_INLINE_ f4 f4_splat(float p_v) { return _mm_set1_ps(p_v); }
+static _FORCE_INLINE_ f4 f4_add(f4 p_a, f4 p_b) { return _mm_add_ps(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_sub(f4 p_a, f4 p_b) { return _mm_sub_ps(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_mul(f4 p_a, f4 p_b) { return _mm_mul_ps(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_min(f4 p_a, f4 p_b) { return _mm_min_ps(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_max(f4 p_a, f4 p_b) { return _mm_max_ps(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_abs(f4 p_v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), p_v); }
+// Lane-wise `p_a > p_b`, as an all-bits mask.
+static _FORCE_INLINE_ f4 f4_greater(f4 p_a, f4 p_b) { return _mm_cmpgt_ps(p_a, p_b); }
+// Lane-wise `p_mask ? p_a : p_b`.
+static _FORCE_INLINE_ f4 f4_select(f4 p_mask, f4 p_a, f4 p_b) { return _mm_or_ps(_mm_and_ps(p_mask, p_a), _mm_andnot_ps(p_mask, p_b)); }
+// True if `p_a >= p_b` in any lane.
+static _FORCE_INLINE_ bool f4_any_greater_equal(f4 p_a, f4 p_b) { return _mm_movemask_ps(_mm_cmpge_ps(p_a, p_b)) != 0; }
+static _FORCE_INLINE_ void f4_transpose(f4 &r_0, f4 &r_1, f4 &r_2, f4 &r_3) { _MM_TRANSPOSE4_PS(r_0, r_1, r_2, r_3); }
+#endif // MATH_BATCH_SSE2
+
+#ifdef MATH_BATCH_NEON
+typedef float32x4_t f4;
+
+static _FORCE_INLINE_ f4 f4_load(const float *p_ptr) { return vld1q_f32(p_ptr); }
+static _FORCE_INLINE_ void f4_store(float *p_ptr, f4 p_v) { vst1q_f32(p_ptr, p_v); }
+static _FORCE_INLINE_ f4 f4_set(float p_x, float p_y, float p_z, float p_w) {
+	const float v[4] = { p_x, p_y, p_z, p_w };
+	return vld1q_f32(v);
+}
+static _FORCE_INLINE_ f4 f4_splat(float p_v) { return vdupq_n_f32(p_v); }
+static _FORCE_INLINE_ f4 f4_add(f4 p_a, f4 p_b) { return vaddq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_sub(f4 p_a, f4 p_b) { return vsubq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_mul(f4 p_a, f4 p_b) { return vmulq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_min(f4 p_a, f4 p_b) { return vminq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_max(f4 p_a, f4 p_b) { return vmaxq_f32(p_a, p_b); }
+static _FORCE_INLINE_ f4 f4_abs(f4 p_v) { return vabsq_f32(p_v); }
+static _FORCE_INLINE_ f4 f4_greater(f4 p_a, f4 p_b) { return vreinterpretq_f32_u32(vcgtq_f32(p_a, p_b)); }
+static _FORCE_INLINE_ f4 f4_select(f4 p_mask, f4 p_a, f4 p_b) { return vbslq_f32(vreinterpretq_u32_f32(p_mask), p_a, p_b); }
+static _FORCE_INLINE_ bool f4_any_greater_equal(f4 p_a, f4 p_b) { return vmaxvq_u32(vcgeq_f32(p_a, p_b)) != 0; }
+static _FORCE_INLINE_ void f4_transpose(f4 &r_0, f4 &r_1, f4 &r_2, f4 &r_3) {
+	const float32x4x2_t t01 = vtrnq_f32(r_0, r_1);
+	const float32x4x2_t t23 = vtrnq_f32(r_2, r_3);
+	r_0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+	r_1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+	r_2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+	r_3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+#endif // MATH_BATCH_NEON
+
+#ifdef MATH_BATCH_SIMD_REAL
+// Columns of a transform (basis columns and origin), with the fourth lane set to zero.
+struct XformColumns {
+	f4 x;
+	f4 y;
+	f4 z;
+	f4 origin;
+
+	_FORCE_INLINE_ XformColumns(const Transform3D &p_transform) {
+		const Basis &b = p_transform.basis;
+		x = f4_set(b.rows[0].x, b.rows[1].x, b.rows[2].x, 0.0f);
+		y = f4_set(b.rows[0].y, b.rows[1].y, b.rows[2].y, 0.0f);
+		z = f4_set(b.rows[0].z, b.rows[1].z, b.rows[2].z, 0.0f);
+		origin = f4_set(p_transform.origin.x, p_transform.origin.y, p_transform.origin.z, 0.0f);
+	}
+
+	// Transposes three row-major 3x4 rows (basis row followed by origin component).
+	_FORCE_INLINE_ XformColumns(const float *p_rows) {
+		x = f4_load(p_rows);
+		y = f4_load(p_rows + 4);
+		z = f4_load(p_rows + 8);
+		origin = f4_splat(0.0f);
+		f4_transpose(x, y, z, origin);
+	}
+
+	// Same operation order as Basis::xform(), so results match the scalar path.
+	_FORCE_INLINE_ f4 xform_basis(float p_x, float p_y, float p_z) const {
+		return f4_add(f4_add(f4_mul(x, f4_splat(p_x)), f4_mul(y, f4_splat(p_y))), f4_mul(z, f4_splat(p_z)));
+	}
+
+	_FORCE_INLINE_ f4 xform(const Vector3 &p_vector) const {
+		return f4_add(xform_basis(p_vector.x, p_vector.y, p_vector.z), origin);
+	}
+
+	// Same algorithm as Transform3D::xform(const AABB &), accumulated per column.
+	_FORCE_INLINE_ void xform_aabb(const Vector3 &p_min, const Vector3 &p_max, f4 &r_min, f4 &r_max) const {
+		r_min = origin;
+		r_max = origin;
+		const f4 *columns[3] = { &x, &y, &z };
+		for (int j = 0; j < 3; j++) {
+			f4 e = f4_mul(*columns[j], f4_splat(p_min[j]));
+			f4 f = f4_mul(*columns[j], f4_splat(p_max[j]));
+			r_min = f4_add(r_min, f4_min(e, f));
+			r_max = f4_add(r_max, f4_max(e, f));
+		}
+	}
+};
+
+static _FORCE_INLINE_ Vector3 f4_to_vector3(f4 p_v) {
+	float v[4];
+	f4_store(v, p_v);
+	return Vector3(v[0], v[1], v[2]);
+}
+
+static _FORCE_INLINE_ void _compose(const XformColumns &p_parent, const Transform3D &p_child, Transform3D &r_dst) {
+	const Basis &b = p_child.basis;
+	f4 cx = p_parent.xform_basis(b.rows[0].x, b.rows[1].x, b.rows[2].x);
+	f4 cy = p_parent.xform_basis(b.rows[0].y, b.rows[1].y, b.rows[2].y);
+	f4 cz = p_parent.xform_basis(b.rows[0].z, b.rows[1].z, b.rows[2].z);
+	f4 o = p_parent.xform(p_child.origin);
+	f4_transpose(cx, cy, cz, o);
+
+	float rows[3][4];
+	f4_store(rows[0], cx);
+	f4_store(rows[1], cy);
+	f4_store(rows[2], cz);
+	for (int i = 0; i < 3; i++) {
+		r_dst.basis.rows[i] = Vector3(rows[i][0], rows[i][1], rows[i][2]);
+		r_dst.origin[i] = rows[i][3];
+	}
+}
+
+static _FORCE_INLINE_ AABB _to_aabb(f4 p_min, f4 p_max) {
+	Vector3 min = f4_to_vector3(p_min);
+	return AABB(min, f4_to_vector3(p_max) - min);
+}
+#endif // MATH_BATCH_SIMD_REAL
+
+// Planes packed four at a time in SoA form, for frustum tests.
+struct PlaneGroup {
+	f4 normal_x;
+	f4 normal_y;
+	f4 normal_z;
+	f4 d;
+	// Set in lanes where the normal component is positive; the box minimum is
+	// tested there, the maximum otherwise (see RendererSceneCull::PlaneSign).
+	f4 positive_x;
+	f4 positive_y;
+	f4 positive_z;
+};
+
+static constexpr uint32_t FRUSTUM_MAX_GROUPS = 8;
+
+// Packs up to FRUSTUM_MAX_GROUPS * 4 planes, relative to p_origin, padding the
+// last group with planes that can never reject a box.
+static uint32_t _pack_planes(const Plane *p_planes, uint32_t p_plane_count, const Vector3 &p_origin, PlaneGroup *r_groups) {
+	uint32_t group_count = (p_plane_count + 3) / 4;
+	for (uint32_t g = 0; g < group_count; g++) {
+		float nx[4], ny[4], nz[4], d[4];
+		for (uint32_t k = 0; k < 4; k++) {
+			uint32_t idx = g * 4 + k;
+			if (idx < p_plane_count) {
+				nx[k] = p_planes[idx].normal.x;
+				ny[k] = p_planes[idx].normal.y;
+				nz[k] = p_planes[idx].normal.z;
+				d[k] = p_planes[idx].d - p_planes[idx].normal.dot(p_origin);
+			} else {
+				nx[k] = ny[k] = nz[k] = 0.0f;
+				d[k] = 1.0f;
+			}
+		}
+		PlaneGroup &group = r_groups[g];
+		group.normal_x = f4_load(nx);
+		group.normal_y = f4_load(ny);
+		group.normal_z = f4_load(nz);
+		group.d = f4_load(d);
+		const f4 zero = f4_splat(0.0f);
+		group.positive_x = f4_greater(group.normal_x, zero);
+		group.positive_y = f4_greater(group.normal_y, zero);
+		group.positive_z = f4_greater(group.normal_z, zero);
+	}
+	return group_count;
+}
+
+static _FORCE_INLINE_ bool _groups_reject(const PlaneGroup *p_groups, uint32_t p_group_count, const float *p_bounds, const float *p_origin) {
+	const f4 min_x = f4_splat(p_bounds[0] - p_origin[0]);
+	const f4 min_y = f4_splat(p_bounds[1] - p_origin[1]);
+	const f4 min_z = f4_splat(p_bounds[2] - p_origin[2]);
+	const f4 max_x = f4_splat(p_bounds[3] - p_origin[0]);
+	const f4 max_y = f4_splat(p_bounds[4] - p_origin[1]);
+	const f4 max_z = f4_splat(p_bounds[5] - p_origin[2]);
+#ifndef REAL_T_IS_DOUBLE
+	const f4 threshold = f4_splat(0.0f);
+#endif
+
+	for (uint32_t g = 0; g < p_group_count; g++) {
+		const PlaneGroup &group = p_groups[g];
+		f4 px = f4_select(group.positive_x, min_x, max_x);
+		f4 py = f4_select(group.positive_y, min_y, max_y);
+		f4 pz = f4_select(group.positive_z, min_z, max_z);
+		f4 tx = f4_mul(group.normal_x, px);
+		f4 ty = f4_mul(group.normal_y, py);
+		f4 tz = f4_mul(group.normal_z, pz);
+		// Same operation order as Plane::distance_to().
+		f4 dist = f4_sub(f4_add(f4_add(tx, ty), tz), group.d);
+#ifdef REAL_T_IS_DOUBLE
+		// The planes and the origin-relative bounds were rounded to single precision,
+		// so only reject boxes further away than the worst case rounding error.
+		f4 magnitude = f4_add(f4_add(f4_add(f4_abs(tx), f4_abs(ty)), f4_abs(tz)), f4_abs(group.d));
+		f4 threshold = f4_mul(magnitude, f4_splat(8.0f * FLT_EPSILON));
+#endif
+		if (f4_any_greater_equal(dist, threshold)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+#endif // MATH_BATCH_SIMD
+
+static _FORCE_INLINE_ bool _plane_rejects(const Plane &p_plane, const float *p_bounds) {
+	Vector3 corner(
+			p_bounds[p_plane.normal.x > 0 ? 0 : 3],
+			p_bounds[p_plane.normal.y > 0 ? 1 : 4],
+			p_bounds[p_plane.normal.z > 0 ? 2 : 5]);
+	return p_plane.distance_to(corner) >= 0.0;
+}
+
+namespace MathBatch {
+
+void xform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD_REAL
+	const XformColumns columns(p_transform);
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = f4_to_vector3(columns.xform(p_src[i]));
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_transform.xform(p_src[i]);
+	}
+#endif
+}
+
+void compose_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD_REAL
+	const XformColumns parent(p_parent);
+	for (uint32_t i = 0; i < p_count; i++) {
+		_compose(parent, p_src[i], r_dst[i]);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_parent * p_src[i];
+	}
+#endif
+}
+
+void compose_transforms(const Transform3D *p_parents, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD_REAL
+	for (uint32_t i = 0; i < p_count; i++) {
+		_compose(XformColumns(p_parents[i]), p_src[i], r_dst[i]);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_parents[i] * p_src[i];
+	}
+#endif
+}
+
+void xform_aabbs(const Transform3D &p_transform, const AABB *p_src, AABB *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD_REAL
+	const XformColumns columns(p_transform);
+	for (uint32_t i = 0; i < p_count; i++) {
+		f4 min, max;
+		columns.xform_aabb(p_src[i].position, p_src[i].position + p_src[i].size, min, max);
+		r_dst[i] = _to_aabb(min, max);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_transform.xform(p_src[i]);
+	}
+#endif
+}
+
+void xform_aabb(const Transform3D *p_transforms, const AABB &p_aabb, AABB *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD_REAL
+	const Vector3 end = p_aabb.position + p_aabb.size;
+	for (uint32_t i = 0; i < p_count; i++) {
+		f4 min, max;
+		XformColumns(p_transforms[i]).xform_aabb(p_aabb.position, end, min, max);
+		r_dst[i] = _to_aabb(min, max);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_transforms[i].xform(p_aabb);
+	}
+#endif
+}
+
+AABB merge_xformed_aabb(const AABB &p_aabb, const float *p_transforms, uint32_t p_stride, uint32_t p_count) {
+	if (p_count == 0) {
+		return AABB();
+	}
+#ifdef MATH_BATCH_SIMD_REAL
+	const Vector3 end = p_aabb.position + p_aabb.size;
+	f4 merged_min, merged_max;
+	XformColumns(p_transforms).xform_aabb(p_aabb.position, end, merged_min, merged_max);
+	for (uint32_t i = 1; i < p_count; i++) {
+		f4 min, max;
+		XformColumns(p_transforms + uint64_t(p_stride) * i).xform_aabb(p_aabb.position, end, min, max);
+		merged_min = f4_min(merged_min, min);
+		merged_max = f4_max(merged_max, max);
+	}
+	return _to_aabb(merged_min, merged_max);
+#else
+	AABB merged;
+	for (uint32_t i = 0; i < p_count; i++) {
+		const float *data = p_transforms + uint64_t(p_stride) * i;
+		Transform3D t;
+		t.basis.rows[0] = Vector3(data[0], data[1], data[2]);
+		t.basis.rows[1] = Vector3(data[4], data[5], data[6]);
+		t.basis.rows[2] = Vector3(data[8], data[9], data[10]);
+		t.origin = Vector3(data[3], data[7], data[11]);
+		if (i == 0) {
+			merged = t.xform(p_aabb);
+		} else {
+			merged.merge_with(t.xform(p_aabb));
+		}
+	}
+	return merged;
+#endif
+}
+
+void frustum_test_bounds(const Plane *p_planes, uint32_t p_plane_count, const float *p_bounds, uint32_t p_count, uint8_t *r_inside, const Vector3 &p_origin) {
+#ifdef MATH_BATCH_SIMD
+#ifdef REAL_T_IS_DOUBLE
+	// Rounded first, so the planes are moved by exactly the offset subtracted from the bounds.
+	const float origin[3] = { float(p_origin.x), float(p_origin.y), float(p_origin.z) };
+#else
+	const float origin[3] = { 0.0f, 0.0f, 0.0f };
+#endif
+	PlaneGroup groups[FRUSTUM_MAX_GROUPS];
+	uint32_t group_count = _pack_planes(p_planes, MIN(p_plane_count, FRUSTUM_MAX_GROUPS * 4), Vector3(origin[0], origin[1], origin[2]), groups);
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_inside[i] = !_groups_reject(groups, group_count, p_bounds + i * 6, origin);
+	}
+
+	// Unusually large plane sets are finished one plane at a time.
+	for (uint32_t p = FRUSTUM_MAX_GROUPS * 4; p < p_plane_count; p++) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			if (r_inside[i] && _plane_rejects(p_planes[p], p_bounds + i * 6)) {
+				r_inside[i] = 0;
+			}
+		}
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		const float *bounds = p_bounds + i * 6;
+		bool inside = true;
+		for (uint32_t p = 0; p < p_plane_count; p++) {
+			if (_plane_rejects(p_planes[p], bounds)) {
+				inside = false;
+				break;
+			}
+		}
+		r_inside[i] = inside;
+	}
+#endif
+}
+
+void frustum_test_aabbs(const Plane *p_planes, uint32_t p_plane_count, const AABB *p_aabbs, uint32_t p_count, uint8_t *r_inside, const Vector3 &p_origin) {
+	const uint32_t CHUNK_SIZE = 64;
+	float bounds[CHUNK_SIZE * 6];
+	for (uint32_t from = 0; from < p_count; from += CHUNK_SIZE) {
+		uint32_t chunk = MIN(CHUNK_SIZE, p_count - from);
+		for (uint32_t i = 0; i < chunk; i++) {
+			store_bounds(p_aabbs[from + i], bounds + i * 6);
+		}
+		frustum_test_bounds(p_planes, p_plane_count, bounds, chunk, r_inside + from, p_origin);
+	}
+}
+
+} // namespace MathBatch
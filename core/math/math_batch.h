@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  math_batch.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/aabb.h"
+#include "core/math/plane.h"
+#include "core/math/transform_3d.h"
+
+#include <cmath>
+
+// Batched versions of the hot Vector3/Transform3D/AABB operations.
+// When `real_t` is single precision, the kernels use SSE2 or NEON depending on
+// the target; otherwise (or on other architectures) they fall back to scalar code
+// producing the same results as the equivalent per-element operations.
+// Frustum tests work on single precision bounds and are vectorized in all builds.
+// Unless stated otherwise, output arrays may alias input arrays.
+namespace MathBatch {
+
+// r_dst[i] = p_transform.xform(p_src[i])
+void xform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count);
+
+// r_dst[i] = p_parent * p_src[i]
+void compose_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count);
+// r_dst[i] = p_parents[i] * p_src[i]
+void compose_transforms(const Transform3D *p_parents, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count);
+
+// r_dst[i] = p_transform.xform(p_src[i])
+void xform_aabbs(const Transform3D &p_transform, const AABB *p_src, AABB *r_dst, uint32_t p_count);
+// r_dst[i] = p_transforms[i].xform(p_aabb)
+void xform_aabb(const Transform3D *p_transforms, const AABB &p_aabb, AABB *r_dst, uint32_t p_count);
+
+// Returns the union of p_aabb transformed by p_count row-major 3x4 float matrices
+// (basis row followed by origin component, as stored in MultiMesh buffers),
+// each starting p_stride floats after the previous one.
+AABB merge_xformed_aabb(const AABB &p_aabb, const float *p_transforms, uint32_t p_stride, uint32_t p_count);
+
+// Stores p_aabb as 6 consecutive single precision values (min x, y, z, max x, y, z),
+// the layout expected by frustum_test_bounds(). In double precision builds the
+// values are rounded outwards, so the stored box always contains p_aabb.
+_FORCE_INLINE_ void store_bounds(const AABB &p_aabb, float *r_bounds) {
+	const Vector3 end = p_aabb.position + p_aabb.size;
+	for (int i = 0; i < 3; i++) {
+#ifdef REAL_T_IS_DOUBLE
+		float min = float(p_aabb.position[i]);
+		if (double(min) > p_aabb.position[i]) {
+			min = std::nextafter(min, -FLT_MAX);
+		}
+		float max = float(end[i]);
+		if (double(max) < end[i]) {
+			max = std::nextafter(max, FLT_MAX);
+		}
+		r_bounds[i] = min;
+		r_bounds[i + 3] = max;
+#else
+		r_bounds[i] = p_aabb.position[i];
+		r_bounds[i + 3] = end[i];
+#endif
+	}
+}
+
+// Conservative frustum test of p_count boxes stored as by store_bounds().
+// A box is rejected when its corner closest to the inside of any plane lies on
+// or above it. r_inside[i] is set to 1 for boxes that pass, 0 otherwise.
+// In double precision builds the test is done in single precision relative to
+// p_origin (typically the camera position), with an error margin growing with the
+// distance to it: boxes very close to a plane may be kept, but are never wrongly
+// rejected. p_origin is ignored in single precision builds.
+void frustum_test_bounds(const Plane *p_planes, uint32_t p_plane_count, const float *p_bounds, uint32_t p_count, uint8_t *r_inside, const Vector3 &p_origin = Vector3());
+// Same as frustum_test_bounds(), for an array of AABBs.
+void frustum_test_aabbs(const Plane *p_planes, uint32_t p_plane_count, const AABB *p_aabbs, uint32_t p_count, uint8_t *r_inside, const Vector3 &p_origin = Vector3());
+
+} // namespace MathBatch
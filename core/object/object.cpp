@@ -2235,9 +2235,10 @@ void postinitialize_handler(Object *p_object) {
 void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+	for (uint32_t i = 0, count = slot_count, max = slot_max.load(std::memory_order_relaxed); i < max && count != 0; i++) {
+		const ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.get_validator(std::memory_order_relaxed)) {
+			p_func(object_slot.object.load(std::memory_order_relaxed));
 			count--;
 		}
 	}
@@ -2292,42 +2293,51 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<uint32_t> ObjectDB::slot_max{ 0 };
+ObjectDB::ObjectSlot *ObjectDB::slot_pages[OBJECTDB_SLOT_MAX_PAGES] = {};
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
 	return slot_count;
 }
 
+void ObjectDB::_set_slot_state(ObjectSlot &p_slot, uint64_t p_validator, uint32_t p_next_free, bool p_is_ref_counted) {
+	uint64_t state = p_validator | (uint64_t(p_next_free) << OBJECTDB_VALIDATOR_BITS);
+	if (p_is_ref_counted) {
+		state |= OBJECTDB_REFERENCE_BIT;
+	}
+	// Release, so the object pointer written before a new validator is visible to lookups that see it.
+	p_slot.state.store(state, std::memory_order_release);
+}
+
 ObjectID ObjectDB::add_instance(Object *p_object) {
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
+	uint32_t current_max = slot_max.load(std::memory_order_relaxed);
+	if (unlikely(slot_count == current_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		// Existing pages are never reallocated, since lookups may be reading them without the lock.
+		ObjectSlot *page = memnew_arr(ObjectSlot, OBJECTDB_SLOT_PAGE_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_PAGE_SIZE; i++) {
+			page[i].object.store(nullptr, std::memory_order_relaxed);
+			_set_slot_state(page[i], 0, current_max + i, false);
 		}
-		slot_max = new_slot_max;
+		slot_pages[current_max >> OBJECTDB_SLOT_PAGE_BITS] = page;
+		slot_max.store(current_max + OBJECTDB_SLOT_PAGE_SIZE, std::memory_order_release);
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = _get_slot(slot_count).get_next_free();
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
+	object_slot.object.store(p_object, std::memory_order_relaxed);
+	_set_slot_state(object_slot, validator_counter, object_slot.get_next_free(), p_object->is_ref_counted());
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -2350,17 +2360,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if (object_slot.get_validator(std::memory_order_relaxed) != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_COND(object_slot.get_validator(std::memory_order_relaxed) != validator);
 		}
 	}
 
@@ -2368,11 +2380,12 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	ObjectSlot &free_slot = _get_slot(slot_count);
+	_set_slot_state(free_slot, free_slot.get_validator(std::memory_order_relaxed), slot, free_slot.is_ref_counted());
+	//invalidate before clearing the object, so concurrent lookups fail their second validator check
+	_set_slot_state(object_slot, 0, object_slot.get_next_free(), false);
+	std::atomic_thread_fence(std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_relaxed);
 
 	spin_lock.unlock();
 }
@@ -2394,9 +2407,10 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count, max = slot_max.load(std::memory_order_relaxed); i < max && count != 0; i++) {
+				const ObjectSlot &object_slot = _get_slot(i);
+				if (object_slot.get_validator(std::memory_order_relaxed)) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2406,7 +2420,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (object_slot.get_validator(std::memory_order_relaxed) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slot.is_ref_counted() ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2417,9 +2431,12 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	uint32_t max = slot_max.load(std::memory_order_relaxed);
+	for (uint32_t i = 0; i < max; i += OBJECTDB_SLOT_PAGE_SIZE) {
+		memdelete_arr(slot_pages[i >> OBJECTDB_SLOT_PAGE_BITS]);
+		slot_pages[i >> OBJECTDB_SLOT_PAGE_BITS] = nullptr;
 	}
+	slot_max.store(0, std::memory_order_relaxed);
 
 	spin_lock.unlock();
 }
@@ -1027,20 +1027,35 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
+// Slots are allocated in pages that never move, so lookups can run without locking.
+#define OBJECTDB_SLOT_PAGE_BITS 12
+#define OBJECTDB_SLOT_PAGE_SIZE (uint32_t(1) << OBJECTDB_SLOT_PAGE_BITS)
+#define OBJECTDB_SLOT_PAGE_MASK (OBJECTDB_SLOT_PAGE_SIZE - 1)
+#define OBJECTDB_SLOT_MAX_PAGES (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_PAGE_BITS))
 
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Packs the validator (low bits), the free list link and the reference flag (high bit),
+		// so readers get a consistent validator with a single load.
+		std::atomic<uint64_t> state;
+		std::atomic<Object *> object;
+
+		_FORCE_INLINE_ uint64_t get_validator(std::memory_order p_order) const { return state.load(p_order) & OBJECTDB_VALIDATOR_MASK; }
+		_FORCE_INLINE_ uint32_t get_next_free() const { return (state.load(std::memory_order_relaxed) >> OBJECTDB_VALIDATOR_BITS) & OBJECTDB_SLOT_MAX_COUNT_MASK; }
+		_FORCE_INLINE_ bool is_ref_counted() const { return state.load(std::memory_order_relaxed) & OBJECTDB_REFERENCE_BIT; }
 	};
 
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<uint32_t> slot_max;
+	static ObjectSlot *slot_pages[OBJECTDB_SLOT_MAX_PAGES];
 	static uint64_t validator_counter;
 
+	_FORCE_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_pages[p_slot >> OBJECTDB_SLOT_PAGE_BITS][p_slot & OBJECTDB_SLOT_PAGE_MASK];
+	}
+	// Writers must hold `spin_lock`.
+	static void _set_slot_state(ObjectSlot &p_slot, uint64_t p_validator, uint32_t p_next_free, bool p_is_ref_counted);
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1054,24 +1069,30 @@ class ObjectDB {
 public:
 	typedef void (*DebugFunc)(Object *p_obj);
 
+	// Lock-free. The validator is checked before and after reading the object pointer (like a seqlock),
+	// so a slot that is released or reused concurrently is never reported as the requested instance.
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ERR_FAIL_COND_V(slot >= slot_max.load(std::memory_order_acquire), nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		if (unlikely(validator == 0)) {
+			return nullptr; // Free slots have a zero validator.
+		}
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		const ObjectSlot &object_slot = _get_slot(slot);
+		if (unlikely(object_slot.get_validator(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_relaxed);
 
-		spin_lock.unlock();
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (unlikely(object_slot.get_validator(std::memory_order_relaxed) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -667,6 +667,150 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 		p_instance->set(p_index, p_value);                                                                      \
 	}
 
+// Bulk operations on packed arrays. Each one is a single loop over the raw buffer with no
+// per-element Variant dispatch, written so that compilers can vectorize it.
+#define VARCALL_PACKED_ARRAY_ARITHMETIC(m_packed_type, m_type, m_scalar_type, m_sum_type, m_sum_zero)                           \
+	static void func_##m_packed_type##_offset(m_packed_type *p_instance, const m_type &p_value) {                               \
+		const m_type value = p_value;                                                                                           \
+		m_type *w = p_instance->ptrw();                                                                                         \
+		const int64_t size = p_instance->size();                                                                                \
+		for (int64_t i = 0; i < size; i++) {                                                                                    \
+			w[i] += value;                                                                                                      \
+		}                                                                                                                       \
+	}                                                                                                                           \
+	static void func_##m_packed_type##_scale(m_packed_type *p_instance, m_scalar_type p_factor) {                               \
+		m_type *w = p_instance->ptrw();                                                                                         \
+		const int64_t size = p_instance->size();                                                                                \
+		for (int64_t i = 0; i < size; i++) {                                                                                    \
+			w[i] *= p_factor;                                                                                                   \
+		}                                                                                                                       \
+	}                                                                                                                           \
+	static void func_##m_packed_type##_multiply_add(m_packed_type *p_instance, m_scalar_type p_factor, const m_type &p_value) { \
+		const m_type value = p_value;                                                                                           \
+		m_type *w = p_instance->ptrw();                                                                                         \
+		const int64_t size = p_instance->size();                                                                                \
+		for (int64_t i = 0; i < size; i++) {                                                                                    \
+			w[i] = w[i] * p_factor + value;                                                                                     \
+		}                                                                                                                       \
+	}                                                                                                                           \
+	static void func_##m_packed_type##_add_array(m_packed_type *p_instance, const m_packed_type &p_array) {                     \
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");                        \
+		m_type *w = p_instance->ptrw();                                                                                         \
+		const m_type *r = p_array.ptr();                                                                                        \
+		const int64_t size = p_instance->size();                                                                                \
+		for (int64_t i = 0; i < size; i++) {                                                                                    \
+			w[i] += r[i];                                                                                                       \
+		}                                                                                                                       \
+	}                                                                                                                           \
+	static void func_##m_packed_type##_multiply_array(m_packed_type *p_instance, const m_packed_type &p_array) {                \
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");                        \
+		m_type *w = p_instance->ptrw();                                                                                         \
+		const m_type *r = p_array.ptr();                                                                                        \
+		const int64_t size = p_instance->size();                                                                                \
+		for (int64_t i = 0; i < size; i++) {                                                                                    \
+			w[i] *= r[i];                                                                                                       \
+		}                                                                                                                       \
+	}                                                                                                                           \
+	static m_sum_type func_##m_packed_type##_sum(m_packed_type *p_instance) {                                                   \
+		/* Independent partial sums, so the additions don't form a single dependency chain. */                                  \
+		m_sum_type partial[4] = { m_sum_zero, m_sum_zero, m_sum_zero, m_sum_zero };                                             \
+		const m_type *r = p_instance->ptr();                                                                                    \
+		const int64_t size = p_instance->size();                                                                                \
+		int64_t i = 0;                                                                                                          \
+		for (; i + 4 <= size; i += 4) {                                                                                         \
+			partial[0] += r[i];                                                                                                 \
+			partial[1] += r[i + 1];                                                                                             \
+			partial[2] += r[i + 2];                                                                                             \
+			partial[3] += r[i + 3];                                                                                             \
+		}                                                                                                                       \
+		for (; i < size; i++) {                                                                                                 \
+			partial[0] += r[i];                                                                                                 \
+		}                                                                                                                       \
+		return (partial[0] + partial[1]) + (partial[2] + partial[3]);                                                           \
+	}
+
+#define VARCALL_PACKED_ARRAY_MIN_MAX(m_packed_type, m_type)               \
+	static m_type func_##m_packed_type##_min(m_packed_type *p_instance) { \
+		const int64_t size = p_instance->size();                          \
+		if (size == 0) {                                                  \
+			return m_type();                                              \
+		}                                                                 \
+		const m_type *r = p_instance->ptr();                              \
+		m_type result = r[0];                                             \
+		for (int64_t i = 1; i < size; i++) {                              \
+			result = MIN(result, r[i]);                                   \
+		}                                                                 \
+		return result;                                                    \
+	}                                                                     \
+	static m_type func_##m_packed_type##_max(m_packed_type *p_instance) { \
+		const int64_t size = p_instance->size();                          \
+		if (size == 0) {                                                  \
+			return m_type();                                              \
+		}                                                                 \
+		const m_type *r = p_instance->ptr();                              \
+		m_type result = r[0];                                             \
+		for (int64_t i = 1; i < size; i++) {                              \
+			result = MAX(result, r[i]);                                   \
+		}                                                                 \
+		return result;                                                    \
+	}
+
+#define VARCALL_PACKED_ARRAY_FLOAT_OPS(m_packed_type, m_type, m_sum_type)                                            \
+	static void func_##m_packed_type##_clamp(m_packed_type *p_instance, m_type p_min, m_type p_max) {                \
+		m_type *w = p_instance->ptrw();                                                                              \
+		const int64_t size = p_instance->size();                                                                     \
+		for (int64_t i = 0; i < size; i++) {                                                                         \
+			w[i] = CLAMP(w[i], p_min, p_max);                                                                        \
+		}                                                                                                            \
+	}                                                                                                                \
+	static void func_##m_packed_type##_lerp(m_packed_type *p_instance, const m_packed_type &p_to, m_type p_weight) { \
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");                \
+		m_type *w = p_instance->ptrw();                                                                              \
+		const m_type *r = p_to.ptr();                                                                                \
+		const int64_t size = p_instance->size();                                                                     \
+		for (int64_t i = 0; i < size; i++) {                                                                         \
+			w[i] = Math::lerp(w[i], r[i], p_weight);                                                                 \
+		}                                                                                                            \
+	}                                                                                                                \
+	static m_sum_type func_##m_packed_type##_dot(m_packed_type *p_instance, const m_packed_type &p_array) {          \
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0, "Both arrays must have the same size.");        \
+		m_sum_type partial[4] = { 0, 0, 0, 0 };                                                                      \
+		const m_type *a = p_instance->ptr();                                                                         \
+		const m_type *b = p_array.ptr();                                                                             \
+		const int64_t size = p_instance->size();                                                                     \
+		int64_t i = 0;                                                                                               \
+		for (; i + 4 <= size; i += 4) {                                                                              \
+			partial[0] += m_sum_type(a[i]) * b[i];                                                                   \
+			partial[1] += m_sum_type(a[i + 1]) * b[i + 1];                                                           \
+			partial[2] += m_sum_type(a[i + 2]) * b[i + 2];                                                           \
+			partial[3] += m_sum_type(a[i + 3]) * b[i + 3];                                                           \
+		}                                                                                                            \
+		for (; i < size; i++) {                                                                                      \
+			partial[0] += m_sum_type(a[i]) * b[i];                                                                   \
+		}                                                                                                            \
+		return (partial[0] + partial[1]) + (partial[2] + partial[3]);                                                \
+	}
+
+#define VARCALL_PACKED_ARRAY_VECTOR_OPS(m_packed_type, m_type, m_weight_type)                                               \
+	static void func_##m_packed_type##_clamp(m_packed_type *p_instance, const m_type &p_min, const m_type &p_max) {         \
+		const m_type min = p_min;                                                                                           \
+		const m_type max = p_max;                                                                                           \
+		m_type *w = p_instance->ptrw();                                                                                     \
+		const int64_t size = p_instance->size();                                                                            \
+		for (int64_t i = 0; i < size; i++) {                                                                                \
+			w[i] = w[i].clamp(min, max);                                                                                    \
+		}                                                                                                                   \
+	}                                                                                                                       \
+	static void func_##m_packed_type##_lerp(m_packed_type *p_instance, const m_packed_type &p_to, m_weight_type p_weight) { \
+		ERR_FAIL_COND_MSG(p_to.size() != p_instance->size(), "Both arrays must have the same size.");                       \
+		m_type *w = p_instance->ptrw();                                                                                     \
+		const m_type *r = p_to.ptr();                                                                                       \
+		const int64_t size = p_instance->size();                                                                            \
+		for (int64_t i = 0; i < size; i++) {                                                                                \
+			w[i] = w[i].lerp(r[i], p_weight);                                                                               \
+		}                                                                                                                   \
+	}
+
 struct _VariantCall {
 	VARCALL_ARRAY_GETTER_SETTER(PackedByteArray, uint8_t)
 	VARCALL_ARRAY_GETTER_SETTER(PackedColorArray, Color)
@@ -680,6 +824,137 @@ struct _VariantCall {
 	VARCALL_ARRAY_GETTER_SETTER(PackedVector4Array, Vector4)
 	VARCALL_ARRAY_GETTER_SETTER(Array, Variant)
 
+	VARCALL_PACKED_ARRAY_ARITHMETIC(PackedFloat32Array, float, float, double, 0.0)
+	VARCALL_PACKED_ARRAY_ARITHMETIC(PackedFloat64Array, double, double, double, 0.0)
+	VARCALL_PACKED_ARRAY_ARITHMETIC(PackedVector2Array, Vector2, real_t, Vector2, Vector2())
+	VARCALL_PACKED_ARRAY_ARITHMETIC(PackedVector3Array, Vector3, real_t, Vector3, Vector3())
+	VARCALL_PACKED_ARRAY_ARITHMETIC(PackedColorArray, Color, float, Color, Color(0, 0, 0, 0))
+	VARCALL_PACKED_ARRAY_MIN_MAX(PackedFloat32Array, float)
+	VARCALL_PACKED_ARRAY_MIN_MAX(PackedFloat64Array, double)
+	VARCALL_PACKED_ARRAY_MIN_MAX(PackedInt32Array, int32_t)
+	VARCALL_PACKED_ARRAY_FLOAT_OPS(PackedFloat32Array, float, double)
+	VARCALL_PACKED_ARRAY_FLOAT_OPS(PackedFloat64Array, double, double)
+	VARCALL_PACKED_ARRAY_VECTOR_OPS(PackedVector2Array, Vector2, real_t)
+	VARCALL_PACKED_ARRAY_VECTOR_OPS(PackedVector3Array, Vector3, real_t)
+	VARCALL_PACKED_ARRAY_VECTOR_OPS(PackedColorArray, Color, float)
+
+	// Integer arithmetic is done on unsigned values, so results wrap around on overflow (like assigning an
+	// out-of-range int to an element) instead of being undefined. Arguments are wrapped to 32 bits the same way.
+	static void func_PackedInt32Array_offset(PackedInt32Array *p_instance, int64_t p_value) {
+		const uint32_t value = uint32_t(p_value);
+		int32_t *w = p_instance->ptrw();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = int32_t(uint32_t(w[i]) + value);
+		}
+	}
+
+	static void func_PackedInt32Array_scale(PackedInt32Array *p_instance, int64_t p_factor) {
+		const uint32_t factor = uint32_t(p_factor);
+		int32_t *w = p_instance->ptrw();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = int32_t(uint32_t(w[i]) * factor);
+		}
+	}
+
+	static void func_PackedInt32Array_multiply_add(PackedInt32Array *p_instance, int64_t p_factor, int64_t p_value) {
+		const uint32_t factor = uint32_t(p_factor);
+		const uint32_t value = uint32_t(p_value);
+		int32_t *w = p_instance->ptrw();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = int32_t(uint32_t(w[i]) * factor + value);
+		}
+	}
+
+	static void func_PackedInt32Array_add_array(PackedInt32Array *p_instance, const PackedInt32Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		int32_t *w = p_instance->ptrw();
+		const int32_t *r = p_array.ptr();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = int32_t(uint32_t(w[i]) + uint32_t(r[i]));
+		}
+	}
+
+	static void func_PackedInt32Array_multiply_array(PackedInt32Array *p_instance, const PackedInt32Array &p_array) {
+		ERR_FAIL_COND_MSG(p_array.size() != p_instance->size(), "Both arrays must have the same size.");
+		int32_t *w = p_instance->ptrw();
+		const int32_t *r = p_array.ptr();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = int32_t(uint32_t(w[i]) * uint32_t(r[i]));
+		}
+	}
+
+	static void func_PackedInt32Array_clamp(PackedInt32Array *p_instance, int64_t p_min, int64_t p_max) {
+		// Bounds outside of the 32-bit range can't be reached by any element, so saturate them instead of wrapping.
+		const int32_t min = int32_t(CLAMP(p_min, int64_t(INT32_MIN), int64_t(INT32_MAX)));
+		const int32_t max = int32_t(CLAMP(p_max, int64_t(INT32_MIN), int64_t(INT32_MAX)));
+		int32_t *w = p_instance->ptrw();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = CLAMP(w[i], min, max);
+		}
+	}
+
+	static int64_t func_PackedInt32Array_sum(PackedInt32Array *p_instance) {
+		// The sum of 32-bit values can't overflow 64 bits for any array that fits in memory.
+		int64_t partial[4] = { 0, 0, 0, 0 };
+		const int32_t *r = p_instance->ptr();
+		const int64_t size = p_instance->size();
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			partial[0] += r[i];
+			partial[1] += r[i + 1];
+			partial[2] += r[i + 2];
+			partial[3] += r[i + 3];
+		}
+		for (; i < size; i++) {
+			partial[0] += r[i];
+		}
+		return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+	}
+
+	static int64_t func_PackedInt32Array_dot(PackedInt32Array *p_instance, const PackedInt32Array &p_array) {
+		ERR_FAIL_COND_V_MSG(p_array.size() != p_instance->size(), 0, "Both arrays must have the same size.");
+		// Each product fits in 64 bits, but their sum may not, so it wraps around like int arithmetic.
+		uint64_t partial[4] = { 0, 0, 0, 0 };
+		const int32_t *a = p_instance->ptr();
+		const int32_t *b = p_array.ptr();
+		const int64_t size = p_instance->size();
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			partial[0] += uint64_t(int64_t(a[i]) * b[i]);
+			partial[1] += uint64_t(int64_t(a[i + 1]) * b[i + 1]);
+			partial[2] += uint64_t(int64_t(a[i + 2]) * b[i + 2]);
+			partial[3] += uint64_t(int64_t(a[i + 3]) * b[i + 3]);
+		}
+		for (; i < size; i++) {
+			partial[0] += uint64_t(int64_t(a[i]) * b[i]);
+		}
+		return int64_t((partial[0] + partial[1]) + (partial[2] + partial[3]));
+	}
+
+	static void func_PackedVector2Array_transform(PackedVector2Array *p_instance, const Transform2D &p_transform) {
+		const Transform2D xform = p_transform;
+		Vector2 *w = p_instance->ptrw();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = xform.xform(w[i]);
+		}
+	}
+
+	static void func_PackedVector3Array_transform(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		const Transform3D xform = p_transform;
+		Vector3 *w = p_instance->ptrw();
+		const int64_t size = p_instance->size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = xform.xform(w[i]);
+		}
+	}
+
 	static String func_PackedByteArray_get_string_from_ascii(PackedByteArray *p_instance) {
 		String s;
 		if (p_instance->size() > 0) {
@@ -2530,6 +2805,17 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedInt32Array, count, sarray("value"), varray());
 	bind_method(PackedInt32Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedInt32Array, offset, _VariantCall::func_PackedInt32Array_offset, sarray("value"), varray());
+	bind_functionnc(PackedInt32Array, scale, _VariantCall::func_PackedInt32Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedInt32Array, multiply_add, _VariantCall::func_PackedInt32Array_multiply_add, sarray("factor", "value"), varray());
+	bind_functionnc(PackedInt32Array, add_array, _VariantCall::func_PackedInt32Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedInt32Array, multiply_array, _VariantCall::func_PackedInt32Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedInt32Array, clamp, _VariantCall::func_PackedInt32Array_clamp, sarray("min", "max"), varray());
+	bind_function(PackedInt32Array, sum, _VariantCall::func_PackedInt32Array_sum, sarray(), varray());
+	bind_function(PackedInt32Array, min, _VariantCall::func_PackedInt32Array_min, sarray(), varray());
+	bind_function(PackedInt32Array, max, _VariantCall::func_PackedInt32Array_max, sarray(), varray());
+	bind_function(PackedInt32Array, dot, _VariantCall::func_PackedInt32Array_dot, sarray("array"), varray());
+
 	/* Int64 Array */
 
 	bind_method(PackedInt64Array, size, sarray(), varray());
@@ -2578,6 +2864,18 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 	bind_method(PackedFloat32Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat32Array, offset, _VariantCall::func_PackedFloat32Array_offset, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, scale, _VariantCall::func_PackedFloat32Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_add, _VariantCall::func_PackedFloat32Array_multiply_add, sarray("factor", "value"), varray());
+	bind_functionnc(PackedFloat32Array, add_array, _VariantCall::func_PackedFloat32Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_array, _VariantCall::func_PackedFloat32Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloat32Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedFloat32Array_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloat32Array_sum, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloat32Array_min, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloat32Array_max, sarray(), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloat32Array_dot, sarray("array"), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -2602,6 +2900,18 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 	bind_method(PackedFloat64Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedFloat64Array, offset, _VariantCall::func_PackedFloat64Array_offset, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, scale, _VariantCall::func_PackedFloat64Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_add, _VariantCall::func_PackedFloat64Array_multiply_add, sarray("factor", "value"), varray());
+	bind_functionnc(PackedFloat64Array, add_array, _VariantCall::func_PackedFloat64Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_array, _VariantCall::func_PackedFloat64Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_PackedFloat64Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_PackedFloat64Array_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloat64Array_sum, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloat64Array_min, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloat64Array_max, sarray(), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_PackedFloat64Array_dot, sarray("array"), varray());
+
 	/* String Array */
 
 	bind_method(PackedStringArray, size, sarray(), varray());
@@ -2650,6 +2960,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
 	bind_method(PackedVector2Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedVector2Array, offset, _VariantCall::func_PackedVector2Array_offset, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, scale, _VariantCall::func_PackedVector2Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedVector2Array, multiply_add, _VariantCall::func_PackedVector2Array_multiply_add, sarray("factor", "value"), varray());
+	bind_functionnc(PackedVector2Array, add_array, _VariantCall::func_PackedVector2Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, multiply_array, _VariantCall::func_PackedVector2Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, clamp, _VariantCall::func_PackedVector2Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedVector2Array, lerp, _VariantCall::func_PackedVector2Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector2Array, transform, _VariantCall::func_PackedVector2Array_transform, sarray("transform"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_PackedVector2Array_sum, sarray(), varray());
+
 	/* Vector3 Array */
 
 	bind_method(PackedVector3Array, size, sarray(), varray());
@@ -2674,6 +2994,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 	bind_method(PackedVector3Array, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedVector3Array, offset, _VariantCall::func_PackedVector3Array_offset, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, scale, _VariantCall::func_PackedVector3Array_scale, sarray("factor"), varray());
+	bind_functionnc(PackedVector3Array, multiply_add, _VariantCall::func_PackedVector3Array_multiply_add, sarray("factor", "value"), varray());
+	bind_functionnc(PackedVector3Array, add_array, _VariantCall::func_PackedVector3Array_add_array, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply_array, _VariantCall::func_PackedVector3Array_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, clamp, _VariantCall::func_PackedVector3Array_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_PackedVector3Array_lerp, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVector3Array_sum, sarray(), varray());
+
 	/* Color Array */
 
 	bind_method(PackedColorArray, size, sarray(), varray());
@@ -2698,6 +3028,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedColorArray, count, sarray("value"), varray());
 	bind_method(PackedColorArray, erase, sarray("value"), varray());
 
+	bind_functionnc(PackedColorArray, offset, _VariantCall::func_PackedColorArray_offset, sarray("value"), varray());
+	bind_functionnc(PackedColorArray, scale, _VariantCall::func_PackedColorArray_scale, sarray("factor"), varray());
+	bind_functionnc(PackedColorArray, multiply_add, _VariantCall::func_PackedColorArray_multiply_add, sarray("factor", "value"), varray());
+	bind_functionnc(PackedColorArray, add_array, _VariantCall::func_PackedColorArray_add_array, sarray("array"), varray());
+	bind_functionnc(PackedColorArray, multiply_array, _VariantCall::func_PackedColorArray_multiply_array, sarray("array"), varray());
+	bind_functionnc(PackedColorArray, clamp, _VariantCall::func_PackedColorArray_clamp, sarray("min", "max"), varray());
+	bind_functionnc(PackedColorArray, lerp, _VariantCall::func_PackedColorArray_lerp, sarray("to", "weight"), varray());
+	bind_function(PackedColorArray, sum, _VariantCall::func_PackedColorArray_sum, sarray(), varray());
+
 	/* Vector4 Array */
 
 	bind_method(PackedVector4Array, size, sarray(), varray());
@@ -35,6 +35,8 @@
 #include "texture_storage.h"
 #include "utilities.h"
 
+#include "core/math/math_batch.h"
+
 using namespace GLES3;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -1681,35 +1683,24 @@ void MeshStorage::_multimesh_re_create_aabb(MultiMesh *multimesh, const float *p
 	if (multimesh->custom_aabb != AABB()) {
 		return;
 	}
-	AABB aabb;
 	AABB mesh_aabb = mesh_get_aabb(multimesh->mesh);
+	if (multimesh->xform_format == RS::MULTIMESH_TRANSFORM_3D) {
+		multimesh->aabb = MathBatch::merge_xformed_aabb(mesh_aabb, p_data, multimesh->stride_cache, MAX(p_instances, 0));
+		return;
+	}
+
+	AABB aabb;
 	for (int i = 0; i < p_instances; i++) {
 		const float *data = p_data + multimesh->stride_cache * i;
 		Transform3D t;
 
-		if (multimesh->xform_format == RS::MULTIMESH_TRANSFORM_3D) {
-			t.basis.rows[0][0] = data[0];
-			t.basis.rows[0][1] = data[1];
-			t.basis.rows[0][2] = data[2];
-			t.origin.x = data[3];
-			t.basis.rows[1][0] = data[4];
-			t.basis.rows[1][1] = data[5];
-			t.basis.rows[1][2] = data[6];
-			t.origin.y = data[7];
-			t.basis.rows[2][0] = data[8];
-			t.basis.rows[2][1] = data[9];
-			t.basis.rows[2][2] = data[10];
-			t.origin.z = data[11];
-
-		} else {
-			t.basis.rows[0][0] = data[0];
-			t.basis.rows[0][1] = data[1];
-			t.origin.x = data[3];
+		t.basis.rows[0][0] = data[0];
+		t.basis.rows[0][1] = data[1];
+		t.origin.x = data[3];
 
-			t.basis.rows[1][0] = data[4];
-			t.basis.rows[1][1] = data[5];
-			t.origin.y = data[7];
-		}
+		t.basis.rows[1][0] = data[4];
+		t.basis.rows[1][1] = data[5];
+		t.origin.y = data[7];
 
 		if (i == 0) {
 			aabb = t.xform(mesh_aabb);
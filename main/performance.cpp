@@ -119,6 +119,13 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_STEP_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_BROAD_PHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_NARROW_PHASE_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SOLVER_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_INTEGRATION_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_STATE_SYNC_TIME);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_AREA_CALLBACK_TIME);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -193,6 +200,13 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_connected"),
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
+		PNAME("physics_3d/step_time"),
+		PNAME("physics_3d/broad_phase_time"),
+		PNAME("physics_3d/narrow_phase_time"),
+		PNAME("physics_3d/solver_time"),
+		PNAME("physics_3d/integration_time"),
+		PNAME("physics_3d/state_sync_time"),
+		PNAME("physics_3d/area_callback_time"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -352,6 +366,38 @@ double Performance::get_monitor(Monitor p_monitor) const {
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 
+#ifndef PHYSICS_3D_DISABLED
+		case PHYSICS_3D_STEP_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_STEP_TIME));
+		case PHYSICS_3D_BROAD_PHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_BROAD_PHASE_TIME));
+		case PHYSICS_3D_NARROW_PHASE_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_NARROW_PHASE_TIME));
+		case PHYSICS_3D_SOLVER_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_SOLVER_TIME));
+		case PHYSICS_3D_INTEGRATION_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_INTEGRATION_TIME));
+		case PHYSICS_3D_STATE_SYNC_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_STATE_SYNC_TIME));
+		case PHYSICS_3D_AREA_CALLBACK_TIME:
+			return USEC_TO_SEC(PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_AREA_CALLBACK_TIME));
+#else
+		case PHYSICS_3D_STEP_TIME:
+			return 0;
+		case PHYSICS_3D_BROAD_PHASE_TIME:
+			return 0;
+		case PHYSICS_3D_NARROW_PHASE_TIME:
+			return 0;
+		case PHYSICS_3D_SOLVER_TIME:
+			return 0;
+		case PHYSICS_3D_INTEGRATION_TIME:
+			return 0;
+		case PHYSICS_3D_STATE_SYNC_TIME:
+			return 0;
+		case PHYSICS_3D_AREA_CALLBACK_TIME:
+			return 0;
+#endif // PHYSICS_3D_DISABLED
+
 		default: {
 		}
 	}
@@ -422,6 +468,13 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -125,6 +125,13 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		PHYSICS_3D_STEP_TIME,
+		PHYSICS_3D_BROAD_PHASE_TIME,
+		PHYSICS_3D_NARROW_PHASE_TIME,
+		PHYSICS_3D_SOLVER_TIME,
+		PHYSICS_3D_INTEGRATION_TIME,
+		PHYSICS_3D_STATE_SYNC_TIME,
+		PHYSICS_3D_AREA_CALLBACK_TIME,
 		MONITOR_MAX
 	};
 
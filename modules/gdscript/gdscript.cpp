@@ -35,6 +35,7 @@
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_tokenizer_buffer.h"
 #include "gdscript_warning.h"
 
@@ -2279,6 +2280,12 @@ void GDScriptLanguage::init() {
 	}
 #endif
 
+#ifdef DEBUG_ENABLED
+	if (GLOBAL_GET("debug/gdscript/sampling_profiler/enabled")) {
+		sampling_profiler->start(GLOBAL_GET("debug/gdscript/sampling_profiler/interval_usec"));
+	}
+#endif
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2320,6 +2327,17 @@ void GDScriptLanguage::finish() {
 	}
 	finishing = true;
 
+#ifdef DEBUG_ENABLED
+	if (sampling_profiler->is_active()) {
+		sampling_profiler->stop();
+
+		const String output_path = GLOBAL_GET("debug/gdscript/sampling_profiler/output_path");
+		if (!output_path.is_empty() && sampling_profiler->save_folded_stacks(output_path) == OK) {
+			print_line(vformat("GDScript: Saved %d profiler samples to \"%s\".", sampling_profiler->get_sample_count(), output_path));
+		}
+	}
+#endif
+
 	_call_stack.free();
 
 	// Clear the cache before parsing the script_list
@@ -2919,6 +2937,19 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+Mutex GDScriptLanguage::call_stacks_mutex;
+LocalVector<GDScriptLanguage::CallStack *> GDScriptLanguage::call_stacks;
+
+void GDScriptLanguage::_register_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	p_call_stack->thread_id = Thread::get_caller_id();
+	call_stacks.push_back(p_call_stack);
+}
+
+void GDScriptLanguage::_unregister_call_stack(CallStack *p_call_stack) {
+	MutexLock lock(call_stacks_mutex);
+	call_stacks.erase(p_call_stack);
+}
 
 GDScriptLanguage::GDScriptLanguage() {
 	ERR_FAIL_COND(singleton);
@@ -2948,11 +2979,23 @@ GDScriptLanguage::GDScriptLanguage() {
 		//debugging enabled!
 
 		_debug_max_call_stack = dmcs;
+		_track_call_stack = true;
 	} else {
 		_debug_max_call_stack = 0;
 	}
 
 #ifdef DEBUG_ENABLED
+	GLOBAL_DEF("debug/gdscript/sampling_profiler/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/gdscript/sampling_profiler/interval_usec", PROPERTY_HINT_RANGE, "100,100000,1,or_greater,suffix:usec"), GDScriptSamplingProfiler::DEFAULT_INTERVAL_USEC);
+	GLOBAL_DEF(PropertyInfo(Variant::STRING, "debug/gdscript/sampling_profiler/output_path", PROPERTY_HINT_SAVE_FILE), "user://gdscript_samples.folded");
+
+	if (!_track_call_stack && GLOBAL_GET("debug/gdscript/sampling_profiler/enabled")) {
+		// No debugger to break on overflow, so make room for every level the VM itself allows.
+		_debug_max_call_stack = GDScriptFunction::MAX_CALL_DEPTH;
+		_track_call_stack = true;
+	}
+	sampling_profiler = memnew(GDScriptSamplingProfiler);
+
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/exclude_addons", true);
 	GLOBAL_DEF("debug/gdscript/warnings/renamed_in_godot_4_hint", true);
@@ -2966,6 +3009,9 @@ GDScriptLanguage::GDScriptLanguage() {
 }
 
 GDScriptLanguage::~GDScriptLanguage() {
+#ifdef DEBUG_ENABLED
+	memdelete(sampling_profiler);
+#endif
 	singleton = nullptr;
 }
 
@@ -40,6 +40,10 @@
 #include "core/object/script_language.h"
 #include "core/templates/rb_set.h"
 
+#include <atomic>
+
+class GDScriptSamplingProfiler;
+
 class GDScriptNativeClass : public RefCounted {
 	GDCLASS(GDScriptNativeClass, RefCounted);
 
@@ -416,6 +420,7 @@ public:
 
 class GDScriptLanguage : public ScriptLanguage {
 	friend class GDScriptFunctionState;
+	friend class GDScriptSamplingProfiler;
 
 	static GDScriptLanguage *singleton;
 
@@ -429,7 +434,8 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	struct CallLevel {
 		Variant *stack = nullptr;
-		GDScriptFunction *function = nullptr;
+		// Atomic because the sampling profiler reads it from another thread.
+		std::atomic<GDScriptFunction *> function = nullptr;
 		GDScriptInstance *instance = nullptr;
 		int *ip = nullptr;
 		int *line = nullptr;
@@ -440,11 +446,15 @@ class GDScriptLanguage : public ScriptLanguage {
 	static thread_local String _debug_error;
 	struct CallStack {
 		CallLevel *levels = nullptr;
-		int stack_pos = 0;
+		// Only written by the owning thread. Pushes and pops store with release ordering, so a sampler
+		// loading it with acquire ordering sees the levels below it fully written.
+		std::atomic<int> stack_pos = 0;
+		Thread::ID thread_id = Thread::UNASSIGNED_ID;
 
 		void free() {
 			if (levels) {
-				memdelete(levels);
+				_unregister_call_stack(this);
+				memdelete_arr(levels);
 				levels = nullptr;
 			}
 		}
@@ -455,6 +465,13 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	static thread_local CallStack _call_stack;
 	int _debug_max_call_stack = 0;
+	bool _track_call_stack = false;
+
+	// Every thread's call stack is registered here once allocated, so the sampling profiler can walk them.
+	static Mutex call_stacks_mutex;
+	static LocalVector<CallStack *> call_stacks;
+	static void _register_call_stack(CallStack *p_call_stack);
+	static void _unregister_call_stack(CallStack *p_call_stack);
 
 	void _add_global(const StringName &p_name, const Variant &p_value);
 	void _remove_global(const StringName &p_name);
@@ -467,12 +484,15 @@ class GDScriptLanguage : public ScriptLanguage {
 
 	SelfList<GDScript>::List script_list;
 	friend class GDScriptFunction;
+	friend class TestGDScriptSamplingProfilerAccessor;
 
 	SelfList<GDScriptFunction>::List function_list;
 #ifdef DEBUG_ENABLED
 	bool profiling;
 	bool profile_native_calls;
 	uint64_t script_frame_time;
+
+	GDScriptSamplingProfiler *sampling_profiler = nullptr;
 #endif
 
 	HashMap<String, ObjectID> orphan_subclasses;
@@ -486,52 +506,70 @@ public:
 	bool debug_break(const String &p_error, bool p_allow_continue = true);
 	bool debug_break_parse(const String &p_file, int p_line, const String &p_error);
 
+	// True when the call stack is maintained, either for the debugger or for the sampling profiler.
+	_FORCE_INLINE_ bool is_tracking_call_stack() const { return _track_call_stack; }
+
 	_FORCE_INLINE_ void enter_function(GDScriptInstance *p_instance, GDScriptFunction *p_function, Variant *p_stack, int *p_ip, int *p_line) {
 		if (unlikely(_call_stack.levels == nullptr)) {
 			_call_stack.levels = memnew_arr(CallLevel, _debug_max_call_stack + 1);
+			_register_call_stack(&_call_stack);
 		}
 
-		if (EngineDebugger::get_script_debugger()->get_lines_left() > 0 && EngineDebugger::get_script_debugger()->get_depth() >= 0) {
-			EngineDebugger::get_script_debugger()->set_depth(EngineDebugger::get_script_debugger()->get_depth() + 1);
+		ScriptDebugger *script_debugger = EngineDebugger::get_script_debugger();
+		if (script_debugger && script_debugger->get_lines_left() > 0 && script_debugger->get_depth() >= 0) {
+			script_debugger->set_depth(script_debugger->get_depth() + 1);
 		}
 
-		if (_call_stack.stack_pos >= _debug_max_call_stack) {
+		const int stack_pos = _call_stack.stack_pos.load(std::memory_order_relaxed);
+		if (stack_pos >= _debug_max_call_stack) {
 			//stack overflow
 			_debug_error = vformat("Stack overflow (stack size: %s). Check for infinite recursion in your script.", _debug_max_call_stack);
-			EngineDebugger::get_script_debugger()->debug(this);
+			if (script_debugger) {
+				script_debugger->debug(this);
+			} else {
+				ERR_PRINT(_debug_error);
+			}
 			return;
 		}
 
-		_call_stack.levels[_call_stack.stack_pos].stack = p_stack;
-		_call_stack.levels[_call_stack.stack_pos].instance = p_instance;
-		_call_stack.levels[_call_stack.stack_pos].function = p_function;
-		_call_stack.levels[_call_stack.stack_pos].ip = p_ip;
-		_call_stack.levels[_call_stack.stack_pos].line = p_line;
-		_call_stack.stack_pos++;
+		_call_stack.levels[stack_pos].stack = p_stack;
+		_call_stack.levels[stack_pos].instance = p_instance;
+		_call_stack.levels[stack_pos].function.store(p_function, std::memory_order_relaxed);
+		_call_stack.levels[stack_pos].ip = p_ip;
+		_call_stack.levels[stack_pos].line = p_line;
+		_call_stack.stack_pos.store(stack_pos + 1, std::memory_order_release);
 	}
 
 	_FORCE_INLINE_ void exit_function() {
-		if (EngineDebugger::get_script_debugger()->get_lines_left() > 0 && EngineDebugger::get_script_debugger()->get_depth() >= 0) {
-			EngineDebugger::get_script_debugger()->set_depth(EngineDebugger::get_script_debugger()->get_depth() - 1);
+		ScriptDebugger *script_debugger = EngineDebugger::get_script_debugger();
+		if (script_debugger && script_debugger->get_lines_left() > 0 && script_debugger->get_depth() >= 0) {
+			script_debugger->set_depth(script_debugger->get_depth() - 1);
 		}
 
-		if (_call_stack.stack_pos == 0) {
+		const int stack_pos = _call_stack.stack_pos.load(std::memory_order_relaxed);
+		if (stack_pos == 0) {
 			_debug_error = "Stack Underflow (Engine Bug)";
-			EngineDebugger::get_script_debugger()->debug(this);
+			if (script_debugger) {
+				script_debugger->debug(this);
+			} else {
+				ERR_PRINT(_debug_error);
+			}
 			return;
 		}
 
-		_call_stack.stack_pos--;
+		_call_stack.stack_pos.store(stack_pos - 1, std::memory_order_release);
 	}
 
 	virtual Vector<StackInfo> debug_get_current_stack_info() override {
 		Vector<StackInfo> csi;
-		csi.resize(_call_stack.stack_pos);
-		for (int i = 0; i < _call_stack.stack_pos; i++) {
-			csi.write[_call_stack.stack_pos - i - 1].line = _call_stack.levels[i].line ? *_call_stack.levels[i].line : 0;
-			if (_call_stack.levels[i].function) {
-				csi.write[_call_stack.stack_pos - i - 1].func = _call_stack.levels[i].function->get_name();
-				csi.write[_call_stack.stack_pos - i - 1].file = _call_stack.levels[i].function->get_script()->get_script_path();
+		const int stack_pos = _call_stack.stack_pos.load(std::memory_order_relaxed);
+		csi.resize(stack_pos);
+		for (int i = 0; i < stack_pos; i++) {
+			csi.write[stack_pos - i - 1].line = _call_stack.levels[i].line ? *_call_stack.levels[i].line : 0;
+			const GDScriptFunction *function = _call_stack.levels[i].function.load(std::memory_order_relaxed);
+			if (function) {
+				csi.write[stack_pos - i - 1].func = function->get_name();
+				csi.write[stack_pos - i - 1].file = function->get_script()->get_script_path();
 			}
 		}
 		return csi;
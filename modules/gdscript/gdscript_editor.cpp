@@ -309,7 +309,7 @@ String GDScriptLanguage::debug_get_stack_level_function(int p_level) const {
 
 	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos, "");
 	int l = _call_stack.stack_pos - p_level - 1;
-	return _call_stack.levels[l].function->get_name();
+	return _call_stack.levels[l].function.load(std::memory_order_relaxed)->get_name();
 }
 
 String GDScriptLanguage::debug_get_stack_level_source(int p_level) const {
@@ -319,7 +319,7 @@ String GDScriptLanguage::debug_get_stack_level_source(int p_level) const {
 
 	ERR_FAIL_INDEX_V(p_level, _call_stack.stack_pos, "");
 	int l = _call_stack.stack_pos - p_level - 1;
-	return _call_stack.levels[l].function->get_source();
+	return _call_stack.levels[l].function.load(std::memory_order_relaxed)->get_source();
 }
 
 void GDScriptLanguage::debug_get_stack_level_locals(int p_level, List<String> *p_locals, List<Variant> *p_values, int p_max_subitems, int p_max_depth) {
@@ -330,7 +330,7 @@ void GDScriptLanguage::debug_get_stack_level_locals(int p_level, List<String> *p
 	ERR_FAIL_INDEX(p_level, _call_stack.stack_pos);
 	int l = _call_stack.stack_pos - p_level - 1;
 
-	GDScriptFunction *f = _call_stack.levels[l].function;
+	GDScriptFunction *f = _call_stack.levels[l].function.load(std::memory_order_relaxed);
 
 	List<Pair<StringName, int>> locals;
 
@@ -31,6 +31,7 @@
 #include "gdscript_function.h"
 
 #include "gdscript.h"
+#include "gdscript_sampling_profiler.h"
 
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
@@ -129,6 +130,9 @@ GDScriptFunction::~GDScriptFunction() {
 #ifdef DEBUG_ENABLED
 	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 	GDScriptLanguage::get_singleton()->function_list.remove(&function_list);
+	if (GDScriptSamplingProfiler::get_singleton()) {
+		GDScriptSamplingProfiler::get_singleton()->_function_freed(this);
+	}
 #endif
 }
 
@@ -238,7 +242,7 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 		}
 
 #ifdef DEBUG_ENABLED
-		if (EngineDebugger::is_active()) {
+		if (GDScriptLanguage::get_singleton()->is_tracking_call_stack()) {
 			GDScriptLanguage::get_singleton()->exit_function();
 		}
 
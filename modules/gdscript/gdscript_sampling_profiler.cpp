@@ -0,0 +1,292 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#ifdef DEBUG_ENABLED
+
+#include "gdscript.h"
+
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+GDScriptSamplingProfiler *GDScriptSamplingProfiler::singleton = nullptr;
+
+void GDScriptSamplingProfiler::_thread_func(void *p_user) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_user);
+	Thread::set_name("GDScript Sampling Profiler");
+
+	while (profiler->active.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		if (!profiler->active.is_set()) {
+			break;
+		}
+		profiler->_take_sample();
+	}
+}
+
+String GDScriptSamplingProfiler::_get_frame_name(const GDScriptFunction *p_function) {
+	String source = p_function->get_source();
+	if (source.is_empty()) {
+		source = "<built-in>";
+	}
+	// Semicolons separate frames in the folded format.
+	return (source + ":" + String(p_function->get_name())).replace(";", "_");
+}
+
+void GDScriptSamplingProfiler::_update_frame_names(const HashSet<const GDScriptFunction *> &p_functions) {
+	// Functions unregister themselves from the language under this mutex when freed, so the ones
+	// still in the list are alive while their names are read. Only functions found on a stack are
+	// named, others may still be compiling.
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	MutexLock lock(language->mutex);
+	MutexLock names_lock(frame_names_mutex);
+	for (SelfList<GDScriptFunction> *E = language->function_list.first(); E; E = E->next()) {
+		const GDScriptFunction *function = E->self();
+		if (p_functions.has(function)) {
+			frame_names.insert(function, _get_frame_name(function));
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::_function_freed(const GDScriptFunction *p_function) {
+	MutexLock lock(frame_names_mutex);
+	frame_names.erase(p_function);
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	ERR_FAIL_NULL(language);
+
+	// Copy the stacks first. The registry lock keeps the levels allocated, and functions are only
+	// compared by address until they are named below.
+	LocalVector<Thread::ID> threads;
+	LocalVector<uint32_t> depths;
+	LocalVector<const GDScriptFunction *> functions;
+	{
+		MutexLock call_stacks_lock(GDScriptLanguage::call_stacks_mutex);
+
+		for (const GDScriptLanguage::CallStack *call_stack : GDScriptLanguage::call_stacks) {
+			// The owning thread keeps running, so read the depth once and work with that snapshot.
+			// Acquire pairs with the release in enter_function(), so the levels below it are fully written.
+			const int depth = MIN(call_stack->stack_pos.load(std::memory_order_acquire), language->_debug_max_call_stack);
+			if (depth <= 0) {
+				continue;
+			}
+
+			threads.push_back(call_stack->thread_id);
+			depths.push_back(depth);
+			for (int i = 0; i < depth; i++) {
+				functions.push_back(call_stack->levels[i].function.load(std::memory_order_relaxed));
+			}
+		}
+	}
+
+	HashSet<const GDScriptFunction *> unknown_functions;
+	{
+		MutexLock names_lock(frame_names_mutex);
+		for (const GDScriptFunction *function : functions) {
+			if (function && !frame_names.has(function)) {
+				unknown_functions.insert(function);
+			}
+		}
+	}
+	if (!unknown_functions.is_empty()) {
+		_update_frame_names(unknown_functions);
+	}
+
+	LocalVector<String> stacks;
+	{
+		// A function freed since the copy is no longer in the cache, and its frame is skipped.
+		MutexLock names_lock(frame_names_mutex);
+		uint32_t function_index = 0;
+		for (uint32_t i = 0; i < threads.size(); i++) {
+			String folded = threads[i] == Thread::get_main_id() ? String("[main]") : "[thread " + itos(threads[i]) + "]";
+			for (uint32_t j = 0; j < depths[i]; j++) {
+				const GDScriptFunction *function = functions[function_index++];
+				if (!function) {
+					continue;
+				}
+				HashMap<const GDScriptFunction *, String>::ConstIterator E = frame_names.find(function);
+				if (E) {
+					folded += ";" + E->value;
+				}
+			}
+			stacks.push_back(folded);
+		}
+	}
+
+	MutexLock lock(samples_mutex);
+	sample_count++;
+	for (const String &stack : stacks) {
+		samples[stack]++;
+		if (remote_enabled) {
+			unsent_samples[stack]++;
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::_debugger_toggle(bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		uint64_t interval = DEFAULT_INTERVAL_USEC;
+		if (p_opts.size() > 0 && p_opts[0].get_type() == Variant::INT) {
+			interval = MAX(int64_t(p_opts[0]), 1);
+		}
+		stop();
+		clear();
+		{
+			MutexLock lock(samples_mutex);
+			remote_enabled = true;
+		}
+		start(interval);
+	} else {
+		stop();
+		_debugger_tick(); // Flush what was sampled since the last frame.
+		MutexLock lock(samples_mutex);
+		remote_enabled = false;
+	}
+}
+
+void GDScriptSamplingProfiler::_debugger_tick() {
+	HashMap<String, uint64_t> to_send;
+	{
+		MutexLock lock(samples_mutex);
+		if (!remote_enabled || unsent_samples.is_empty()) {
+			return;
+		}
+		to_send = unsent_samples;
+		unsent_samples.clear();
+	}
+
+	if (!EngineDebugger::get_singleton()) {
+		return;
+	}
+
+	// Layout: interval in microseconds, followed by (folded stack, hit count) pairs.
+	Array msg;
+	msg.push_back(interval_usec);
+	for (const KeyValue<String, uint64_t> &E : to_send) {
+		msg.push_back(E.key);
+		msg.push_back(E.value);
+	}
+	EngineDebugger::get_singleton()->send_message("gdscript_sampler:samples", msg);
+}
+
+void GDScriptSamplingProfiler::start(uint64_t p_interval_usec) {
+	ERR_FAIL_COND_MSG(!GDScriptLanguage::get_singleton() || !GDScriptLanguage::get_singleton()->is_tracking_call_stack(), "GDScript call stacks are not tracked. Run with the debugger active, or enable the \"debug/gdscript/sampling_profiler/enabled\" project setting.");
+#ifdef THREADS_ENABLED
+	if (active.is_set()) {
+		return;
+	}
+	interval_usec = MAX(p_interval_usec, uint64_t(1));
+	active.set();
+	thread.start(_thread_func, this);
+#else
+	ERR_FAIL_MSG("The GDScript sampling profiler requires thread support.");
+#endif
+}
+
+void GDScriptSamplingProfiler::stop() {
+#ifdef THREADS_ENABLED
+	if (!active.is_set()) {
+		return;
+	}
+	active.clear();
+	thread.wait_to_finish();
+#endif
+}
+
+void GDScriptSamplingProfiler::clear() {
+	MutexLock lock(samples_mutex);
+	samples.clear();
+	unsent_samples.clear();
+	sample_count = 0;
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() const {
+	MutexLock lock(samples_mutex);
+	return sample_count;
+}
+
+String GDScriptSamplingProfiler::get_folded_stacks() const {
+	Vector<String> lines;
+	{
+		MutexLock lock(samples_mutex);
+		lines.resize(samples.size());
+		int i = 0;
+		for (const KeyValue<String, uint64_t> &E : samples) {
+			lines.write[i++] = E.key + " " + itos(E.value);
+		}
+	}
+	lines.sort();
+
+	String result;
+	for (const String &line : lines) {
+		result += line + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save_folded_stacks(const String &p_path) const {
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, vformat("Cannot write GDScript samples to '%s'.", p_path));
+	file->store_string(get_folded_stacks());
+	return OK;
+}
+
+GDScriptSamplingProfiler::GDScriptSamplingProfiler() {
+	singleton = this;
+
+	if (EngineDebugger::is_active()) {
+		EngineDebugger::Profiler profiler(
+				this,
+				[](void *p_user, bool p_enable, const Array &p_opts) {
+					static_cast<GDScriptSamplingProfiler *>(p_user)->_debugger_toggle(p_enable, p_opts);
+				},
+				nullptr,
+				[](void *p_user, double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+					static_cast<GDScriptSamplingProfiler *>(p_user)->_debugger_tick();
+				});
+		EngineDebugger::register_profiler("gdscript_sampler", profiler);
+		debugger_registered = true;
+	}
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	if (debugger_registered) {
+		EngineDebugger::unregister_profiler("gdscript_sampler");
+	}
+	stop();
+	singleton = nullptr;
+}
+
+#endif // DEBUG_ENABLED
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG_ENABLED
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/array.h"
+
+class GDScriptFunction;
+
+// Periodically captures the GDScript call stack of every thread running scripts, and aggregates
+// them as folded stacks ("frame;frame;frame count" lines), which flame graph tools consume directly.
+// Unlike the instrumenting profiler, the cost does not depend on how many functions are called.
+//
+// Sampling never takes the GDScriptLanguage mutex in the steady state. The stacks are copied under
+// the call stack registry lock, which threads only take when they first run a script or exit, and
+// frames are named from a cache of function names. The language mutex is only taken to refill the
+// cache when a sample contains a function it doesn't know yet.
+class GDScriptSamplingProfiler {
+	friend class GDScriptFunction;
+	friend class TestGDScriptSamplingProfilerAccessor;
+
+	static GDScriptSamplingProfiler *singleton;
+
+#ifdef THREADS_ENABLED
+	Thread thread;
+#endif
+	SafeFlag active;
+	uint64_t interval_usec = DEFAULT_INTERVAL_USEC;
+
+	mutable Mutex samples_mutex;
+	HashMap<String, uint64_t> samples;
+	HashMap<String, uint64_t> unsent_samples;
+	uint64_t sample_count = 0;
+	bool remote_enabled = false;
+	bool debugger_registered = false;
+
+	// Names of the functions seen so far. Freed functions are removed under the language mutex.
+	Mutex frame_names_mutex;
+	HashMap<const GDScriptFunction *, String> frame_names;
+
+	static void _thread_func(void *p_user);
+	static String _get_frame_name(const GDScriptFunction *p_function);
+	void _update_frame_names(const HashSet<const GDScriptFunction *> &p_functions);
+	void _function_freed(const GDScriptFunction *p_function);
+	void _take_sample();
+
+	void _debugger_toggle(bool p_enable, const Array &p_opts);
+	void _debugger_tick();
+
+public:
+	static constexpr uint64_t DEFAULT_INTERVAL_USEC = 1000;
+
+	_FORCE_INLINE_ static GDScriptSamplingProfiler *get_singleton() { return singleton; }
+
+	void start(uint64_t p_interval_usec = DEFAULT_INTERVAL_USEC);
+	void stop();
+	bool is_active() const { return active.is_set(); }
+
+	void clear();
+	uint64_t get_sample_count() const;
+	String get_folded_stacks() const;
+	Error save_folded_stacks(const String &p_path) const;
+
+	GDScriptSamplingProfiler();
+	~GDScriptSamplingProfiler();
+};
+
+#endif // DEBUG_ENABLED
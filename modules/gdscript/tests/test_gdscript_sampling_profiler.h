@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#ifdef DEBUG_ENABLED
+
+#include "../gdscript.h"
+#include "../gdscript_sampling_profiler.h"
+
+#include "tests/test_macros.h"
+
+class TestGDScriptSamplingProfilerAccessor {
+public:
+	static void take_sample(GDScriptSamplingProfiler *p_profiler) {
+		p_profiler->_take_sample();
+	}
+
+	static int get_max_call_stack() {
+		return GDScriptLanguage::get_singleton()->_debug_max_call_stack;
+	}
+
+	// The levels of a call stack are allocated on first use with the maximum depth at that time,
+	// so drop the calling thread's empty stack to have it allocated again with the new depth.
+	static void set_max_call_stack(int p_max_call_stack) {
+		REQUIRE(GDScriptLanguage::_call_stack.stack_pos.load() == 0);
+		GDScriptLanguage::get_singleton()->_debug_max_call_stack = p_max_call_stack;
+		GDScriptLanguage::_call_stack.free();
+	}
+};
+
+namespace TestGDScriptSamplingProfiler {
+
+TEST_CASE("[Modules][GDScript] Sampling profiler folds call stacks") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func outer():
+	pass
+
+func inner():
+	pass
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	GDScriptFunction *outer = gdscript->get_member_functions()[SNAME("outer")];
+	GDScriptFunction *inner = gdscript->get_member_functions()[SNAME("inner")];
+	GDScriptSamplingProfiler *profiler = GDScriptSamplingProfiler::get_singleton();
+	REQUIRE(profiler);
+	REQUIRE_FALSE(profiler->is_active());
+	profiler->clear();
+
+	// Call stacks are not tracked without a debugger, so push the levels by hand as the VM would.
+	GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+	const int old_max_call_stack = TestGDScriptSamplingProfilerAccessor::get_max_call_stack();
+	TestGDScriptSamplingProfilerAccessor::set_max_call_stack(MAX(old_max_call_stack, 8));
+
+	language->enter_function(nullptr, outer, nullptr, nullptr, nullptr);
+	language->enter_function(nullptr, inner, nullptr, nullptr, nullptr);
+	TestGDScriptSamplingProfilerAccessor::take_sample(profiler);
+	TestGDScriptSamplingProfilerAccessor::take_sample(profiler);
+	language->exit_function();
+	TestGDScriptSamplingProfilerAccessor::take_sample(profiler);
+	language->exit_function();
+	// An empty stack still counts as a sample, but adds no line.
+	TestGDScriptSamplingProfilerAccessor::take_sample(profiler);
+
+	TestGDScriptSamplingProfilerAccessor::set_max_call_stack(old_max_call_stack);
+
+	CHECK_EQ(profiler->get_sample_count(), 4);
+	CHECK_EQ(profiler->get_folded_stacks(), "[main];<built-in>:outer 1\n[main];<built-in>:outer;<built-in>:inner 2\n");
+
+	profiler->clear();
+	CHECK_EQ(profiler->get_sample_count(), 0);
+	CHECK(profiler->get_folded_stacks().is_empty());
+}
+
+} // namespace TestGDScriptSamplingProfiler
+
+#endif // DEBUG_ENABLED
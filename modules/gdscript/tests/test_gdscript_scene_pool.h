@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  test_gdscript_scene_pool.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../gdscript.h"
+
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGDScriptScenePool {
+
+TEST_CASE("[Modules][GDScript][PackedScene] Pooled instances reset script variables") {
+	Ref<GDScript> gdscript;
+	gdscript.instantiate();
+	gdscript->set_source_code(R"(
+extends Node
+
+@export var target: Node
+var counter := 0
+var hits: Array[int] = []
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	// root (script)
+	// `- child
+	Node *root = memnew(Node);
+	root->set_name("Root");
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	root->add_child(child);
+	child->set_owner(root);
+	root->set_script(gdscript);
+	root->set("target", child);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	REQUIRE(packed_scene->pack(root) == OK);
+	memdelete(root);
+
+	Node *instance = packed_scene->instantiate_pooled();
+	REQUIRE(instance);
+	Node *instance_child = instance->get_node(NodePath("Child"));
+	REQUIRE(Object::cast_to<Node>(instance->get("target")) == instance_child);
+
+	// Non-exported variables are not stored in the scene, but must still be reset.
+	instance->set("counter", 3);
+	Array hits = instance->get("hits");
+	hits.push_back(1);
+	instance->set("target", instance);
+
+	packed_scene->release_instance(instance);
+	Node *reused = packed_scene->instantiate_pooled();
+	CHECK(reused == instance);
+	CHECK(int(reused->get("counter")) == 0);
+	CHECK(Array(reused->get("hits")).is_empty());
+	CHECK(Object::cast_to<Node>(reused->get("target")) == instance_child);
+
+	memdelete(reused);
+}
+
+} // namespace TestGDScriptScenePool
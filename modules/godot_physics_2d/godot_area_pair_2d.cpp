@@ -91,6 +91,14 @@ void GodotAreaPair2D::solve(real_t p_step) {
 	// Nothing to do.
 }
 
+GodotConstraint2D::OrderKey GodotAreaPair2D::get_order_key() const {
+	OrderKey key;
+	key.object_A = body->get_self().get_id();
+	key.object_B = area->get_self().get_id();
+	key.sub = ((uint64_t)body_shape << 32) | (uint32_t)area_shape;
+	return key;
+}
+
 GodotAreaPair2D::GodotAreaPair2D(GodotBody2D *p_body, int p_body_shape, GodotArea2D *p_area, int p_area_shape) {
 	body = p_body;
 	area = p_area;
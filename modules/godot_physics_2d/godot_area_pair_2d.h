@@ -45,6 +45,8 @@ class GodotAreaPair2D : public GodotConstraint2D {
 	bool body_has_attached_area = false;
 
 public:
+	virtual OrderKey get_order_key() const override;
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
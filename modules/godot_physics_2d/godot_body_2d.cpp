@@ -654,6 +654,43 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 	_update_transform_dependent();
 }
 
+void GodotBody2D::save_step_state(GodotStateWriter2D &p_writer) const {
+	p_writer.write(get_transform());
+	p_writer.write(get_inv_transform());
+	p_writer.write(new_transform);
+	p_writer.write(linear_velocity);
+	p_writer.write(angular_velocity);
+	p_writer.write(prev_linear_velocity);
+	p_writer.write(prev_angular_velocity);
+	p_writer.write(applied_force);
+	p_writer.write(applied_torque);
+	p_writer.write(still_time);
+	p_writer.write(active);
+}
+
+void GodotBody2D::restore_step_state(GodotStateReader2D &p_reader) {
+	Transform2D state_transform;
+	Transform2D state_inv_transform;
+	p_reader.read(state_transform);
+	p_reader.read(state_inv_transform);
+	p_reader.read(new_transform);
+	p_reader.read(linear_velocity);
+	p_reader.read(angular_velocity);
+	p_reader.read(prev_linear_velocity);
+	p_reader.read(prev_angular_velocity);
+	p_reader.read(applied_force);
+	p_reader.read(applied_torque);
+	p_reader.read(still_time);
+	bool state_active = active;
+	p_reader.read(state_active);
+	ERR_FAIL_COND(p_reader.has_failed());
+
+	_set_transform(state_transform);
+	_set_inv_transform(state_inv_transform);
+	_update_transform_dependent();
+	set_active(state_active);
+}
+
 void GodotBody2D::wakeup_neighbours() {
 	for (const Pair<GodotConstraint2D *, int> &E : constraint_list) {
 		const GodotConstraint2D *c = E.first;
@@ -32,6 +32,7 @@
 
 #include "godot_area_2d.h"
 #include "godot_collision_object_2d.h"
+#include "godot_state_buffer_2d.h"
 
 #include "core/templates/list.h"
 #include "core/templates/pair.h"
@@ -317,6 +318,10 @@ public:
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
 
+	// Transform, velocities and sleep state, as saved and restored with the space state.
+	void save_step_state(GodotStateWriter2D &p_writer) const;
+	void restore_step_state(GodotStateReader2D &p_reader);
+
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
 	}
@@ -593,6 +593,67 @@ void GodotBodyPair2D::solve(real_t p_step) {
 	}
 }
 
+GodotConstraint2D::OrderKey GodotBodyPair2D::get_order_key() const {
+	OrderKey key = GodotConstraint2D::get_order_key();
+	key.sub = ((uint64_t)shape_A << 32) | (uint32_t)shape_B;
+	return key;
+}
+
+void GodotBodyPair2D::save_step_state(GodotStateWriter2D &p_writer) const {
+	p_writer.write(sep_axis);
+	p_writer.write(collided);
+	p_writer.write(oneway_disabled);
+	p_writer.write(contact_count);
+	for (int i = 0; i < contact_count; i++) {
+		const Contact &c = contacts[i];
+		p_writer.write(c.position);
+		p_writer.write(c.normal);
+		p_writer.write(c.local_A);
+		p_writer.write(c.local_B);
+		p_writer.write(c.acc_impulse);
+		p_writer.write(c.acc_normal_impulse);
+		p_writer.write(c.acc_tangent_impulse);
+		p_writer.write(c.acc_bias_impulse);
+		p_writer.write(c.acc_bias_impulse_center_of_mass);
+		p_writer.write(c.used);
+	}
+}
+
+void GodotBodyPair2D::restore_step_state(GodotStateReader2D &p_reader) {
+	clear_step_state();
+
+	p_reader.read(sep_axis);
+	p_reader.read(collided);
+	p_reader.read(oneway_disabled);
+	int count = 0;
+	p_reader.read(count);
+	ERR_FAIL_COND(count < 0 || count > MAX_CONTACTS);
+	for (int i = 0; i < count; i++) {
+		Contact &c = contacts[i];
+		p_reader.read(c.position);
+		p_reader.read(c.normal);
+		p_reader.read(c.local_A);
+		p_reader.read(c.local_B);
+		p_reader.read(c.acc_impulse);
+		p_reader.read(c.acc_normal_impulse);
+		p_reader.read(c.acc_tangent_impulse);
+		p_reader.read(c.acc_bias_impulse);
+		p_reader.read(c.acc_bias_impulse_center_of_mass);
+		p_reader.read(c.used);
+	}
+	contact_count = count;
+}
+
+void GodotBodyPair2D::clear_step_state() {
+	for (int i = 0; i < MAX_CONTACTS; i++) {
+		contacts[i] = Contact();
+	}
+	contact_count = 0;
+	sep_axis = Vector2();
+	collided = false;
+	oneway_disabled = false;
+}
+
 GodotBodyPair2D::GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B) :
 		GodotConstraint2D(_arr, 2) {
 	A = p_A;
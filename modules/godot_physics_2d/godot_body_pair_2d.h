@@ -89,10 +89,17 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	_FORCE_INLINE_ void _contact_added_callback(const Vector2 &p_point_A, const Vector2 &p_point_B);
 
 public:
+	virtual OrderKey get_order_key() const override;
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual bool has_step_state() const override { return true; }
+	virtual void save_step_state(GodotStateWriter2D &p_writer) const override;
+	virtual void restore_step_state(GodotStateReader2D &p_reader) override;
+	virtual void clear_step_state() override;
+
 	GodotBodyPair2D(GodotBody2D *p_A, int p_shape_A, GodotBody2D *p_B, int p_shape_B);
 	~GodotBodyPair2D();
 };
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "godot_body_2d.h"
+#include "godot_state_buffer_2d.h"
 
 class GodotConstraint2D {
 	GodotBody2D **_body_ptr;
@@ -47,6 +48,31 @@ protected:
 	}
 
 public:
+	// Identifies a constraint by what it connects rather than by when it was created.
+	// Used to order constraints in deterministic mode and to match them when restoring a space state.
+	struct OrderKey {
+		uint64_t self = 0;
+		uint64_t object_A = 0;
+		uint64_t object_B = 0;
+		uint64_t sub = 0;
+
+		bool operator==(const OrderKey &p_key) const {
+			return self == p_key.self && object_A == p_key.object_A && object_B == p_key.object_B && sub == p_key.sub;
+		}
+		bool operator<(const OrderKey &p_key) const {
+			if (self != p_key.self) {
+				return self < p_key.self;
+			}
+			if (object_A != p_key.object_A) {
+				return object_A < p_key.object_A;
+			}
+			if (object_B != p_key.object_B) {
+				return object_B < p_key.object_B;
+			}
+			return sub < p_key.sub;
+		}
+	};
+
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
@@ -59,9 +85,27 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	virtual OrderKey get_order_key() const {
+		OrderKey key;
+		key.self = self.get_id();
+		if (_body_count > 0 && _body_ptr[0]) {
+			key.object_A = _body_ptr[0]->get_self().get_id();
+		}
+		if (_body_count > 1 && _body_ptr[1]) {
+			key.object_B = _body_ptr[1]->get_self().get_id();
+		}
+		return key;
+	}
+
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
+	// State carried over from one step to the next, like accumulated impulses used for warm starting.
+	virtual bool has_step_state() const { return false; }
+	virtual void save_step_state(GodotStateWriter2D &p_writer) const {}
+	virtual void restore_step_state(GodotStateReader2D &p_reader) {}
+	virtual void clear_step_state() {}
+
 	virtual ~GodotConstraint2D() {}
 };
@@ -256,6 +256,21 @@ void GodotPinJoint2D::solve(real_t p_step) {
 	P += impulse;
 }
 
+void GodotPinJoint2D::save_step_state(GodotStateWriter2D &p_writer) const {
+	p_writer.write(P);
+	p_writer.write(j_acc);
+}
+
+void GodotPinJoint2D::restore_step_state(GodotStateReader2D &p_reader) {
+	p_reader.read(P);
+	p_reader.read(j_acc);
+}
+
+void GodotPinJoint2D::clear_step_state() {
+	P = Vector2();
+	j_acc = 0.0;
+}
+
 void GodotPinJoint2D::set_param(PhysicsServer2D::PinJointParam p_param, real_t p_value) {
 	switch (p_param) {
 		case PhysicsServer2D::PIN_JOINT_SOFTNESS: {
@@ -470,6 +485,18 @@ void GodotGrooveJoint2D::solve(real_t p_step) {
 	}
 }
 
+void GodotGrooveJoint2D::save_step_state(GodotStateWriter2D &p_writer) const {
+	p_writer.write(jn_acc);
+}
+
+void GodotGrooveJoint2D::restore_step_state(GodotStateReader2D &p_reader) {
+	p_reader.read(jn_acc);
+}
+
+void GodotGrooveJoint2D::clear_step_state() {
+	jn_acc = Vector2();
+}
+
 GodotGrooveJoint2D::GodotGrooveJoint2D(const Vector2 &p_a_groove1, const Vector2 &p_a_groove2, const Vector2 &p_b_anchor, GodotBody2D *p_body_a, GodotBody2D *p_body_b) :
 		GodotJoint2D(_arr, 2) {
 	A = p_body_a;
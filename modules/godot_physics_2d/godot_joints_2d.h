@@ -108,6 +108,11 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual bool has_step_state() const override { return true; }
+	virtual void save_step_state(GodotStateWriter2D &p_writer) const override;
+	virtual void restore_step_state(GodotStateReader2D &p_reader) override;
+	virtual void clear_step_state() override;
+
 	void set_param(PhysicsServer2D::PinJointParam p_param, real_t p_value);
 	real_t get_param(PhysicsServer2D::PinJointParam p_param) const;
 
@@ -148,6 +153,11 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual bool has_step_state() const override { return true; }
+	virtual void save_step_state(GodotStateWriter2D &p_writer) const override;
+	virtual void restore_step_state(GodotStateReader2D &p_reader) override;
+	virtual void clear_step_state() override;
+
 	GodotGrooveJoint2D(const Vector2 &p_a_groove1, const Vector2 &p_a_groove2, const Vector2 &p_b_anchor, GodotBody2D *p_body_a, GodotBody2D *p_body_b);
 };
 
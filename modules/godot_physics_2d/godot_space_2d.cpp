@@ -37,6 +37,9 @@
 #include "godot_area_pair_2d.h"
 #include "godot_body_pair_2d.h"
 
+#define STATE_MAGIC 0x53325047 // "GP2S"
+#define STATE_VERSION 1
+
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
@@ -1035,6 +1038,11 @@ void *GodotSpace2D::_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A
 		}
 
 	} else {
+		// The order of the bodies follows their broadphase IDs, which depend on the history of the space.
+		if (self->deterministic && B->get_self() < A->get_self()) {
+			SWAP(A, B);
+			SWAP(p_subindex_A, p_subindex_B);
+		}
 		GodotBodyPair2D *b = memnew(GodotBodyPair2D(static_cast<GodotBody2D *>(A), p_subindex_A, static_cast<GodotBody2D *>(B), p_subindex_B));
 		return b;
 	}
@@ -1089,6 +1097,160 @@ const HashSet<GodotCollisionObject2D *> &GodotSpace2D::get_objects() const {
 	return objects;
 }
 
+struct _BodyOrder2D {
+	_FORCE_INLINE_ bool operator()(const GodotBody2D *p_a, const GodotBody2D *p_b) const {
+		return p_a->get_self() < p_b->get_self();
+	}
+};
+
+struct _ConstraintKeyOrder2D {
+	_FORCE_INLINE_ bool operator()(const Pair<GodotConstraint2D::OrderKey, GodotConstraint2D *> &p_a, const Pair<GodotConstraint2D::OrderKey, GodotConstraint2D *> &p_b) const {
+		return p_a.first < p_b.first;
+	}
+};
+
+void GodotSpace2D::_get_bodies_in_order(LocalVector<GodotBody2D *> &r_bodies) const {
+	r_bodies.clear();
+	for (GodotCollisionObject2D *object : objects) {
+		if (object->get_type() == GodotCollisionObject2D::TYPE_BODY) {
+			r_bodies.push_back(static_cast<GodotBody2D *>(object));
+		}
+	}
+	r_bodies.sort_custom<_BodyOrder2D>();
+}
+
+void GodotSpace2D::_get_stateful_constraints_in_order(const LocalVector<GodotBody2D *> &p_bodies, LocalVector<GodotConstraint2D *> &r_constraints) const {
+	LocalVector<Pair<GodotConstraint2D::OrderKey, GodotConstraint2D *>> keyed;
+	for (const GodotBody2D *body : p_bodies) {
+		for (const Pair<GodotConstraint2D *, int> &E : body->get_constraint_list()) {
+			// Every constraint is listed by its first body, so this visits each one once.
+			if (E.second == 0 && E.first->has_step_state()) {
+				keyed.push_back({ E.first->get_order_key(), E.first });
+			}
+		}
+	}
+	keyed.sort_custom<_ConstraintKeyOrder2D>();
+
+	r_constraints.resize(keyed.size());
+	for (uint32_t i = 0; i < keyed.size(); i++) {
+		r_constraints[i] = keyed[i].second;
+	}
+}
+
+Vector<uint8_t> GodotSpace2D::save_state() {
+	LocalVector<GodotBody2D *> bodies;
+	_get_bodies_in_order(bodies);
+	LocalVector<GodotConstraint2D *> constraints;
+	_get_stateful_constraints_in_order(bodies, constraints);
+
+	state_buffer.clear();
+	GodotStateWriter2D writer(state_buffer);
+	writer.write<uint32_t>(STATE_MAGIC);
+	writer.write<uint32_t>(STATE_VERSION);
+
+	// Each record is prefixed with its size, so records for objects that no longer exist can be skipped on restore.
+	writer.write<uint32_t>(bodies.size());
+	for (const GodotBody2D *body : bodies) {
+		writer.write(body->get_self().get_id());
+		const uint32_t size_position = writer.get_position();
+		writer.write<uint32_t>(0);
+		body->save_step_state(writer);
+		writer.write_at<uint32_t>(size_position, writer.get_position() - size_position - sizeof(uint32_t));
+	}
+
+	writer.write<uint32_t>(constraints.size());
+	for (const GodotConstraint2D *constraint : constraints) {
+		const GodotConstraint2D::OrderKey key = constraint->get_order_key();
+		writer.write(key.self);
+		writer.write(key.object_A);
+		writer.write(key.object_B);
+		writer.write(key.sub);
+		const uint32_t size_position = writer.get_position();
+		writer.write<uint32_t>(0);
+		constraint->save_step_state(writer);
+		writer.write_at<uint32_t>(size_position, writer.get_position() - size_position - sizeof(uint32_t));
+	}
+
+	Vector<uint8_t> state;
+	state.resize(state_buffer.size());
+	memcpy(state.ptrw(), state_buffer.ptr(), state_buffer.size());
+	return state;
+}
+
+Error GodotSpace2D::restore_state(const Vector<uint8_t> &p_state) {
+	GodotStateReader2D reader(p_state.ptr(), p_state.size());
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	reader.read(magic);
+	reader.read(version);
+	ERR_FAIL_COND_V_MSG(reader.has_failed() || magic != STATE_MAGIC || version != STATE_VERSION, ERR_INVALID_DATA, "Invalid physics space state.");
+
+	// Records are sorted like the bodies and constraints of the space, so both lists are walked in step.
+	LocalVector<GodotBody2D *> bodies;
+	_get_bodies_in_order(bodies);
+
+	uint32_t body_count = 0;
+	reader.read(body_count);
+	uint32_t body_index = 0;
+	for (uint32_t i = 0; i < body_count && !reader.has_failed(); i++) {
+		uint64_t id = 0;
+		uint32_t size = 0;
+		reader.read(id);
+		reader.read(size);
+		GodotStateReader2D record(reader.get_ptr(), size);
+		reader.skip(size);
+		if (reader.has_failed()) {
+			break;
+		}
+
+		while (body_index < bodies.size() && bodies[body_index]->get_self().get_id() < id) {
+			body_index++;
+		}
+		if (body_index < bodies.size() && bodies[body_index]->get_self().get_id() == id) {
+			bodies[body_index]->restore_step_state(record);
+		}
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_failed(), ERR_INVALID_DATA, "Invalid physics space state.");
+
+	// Pairs depend on where the bodies are, let the broadphase catch up before restoring contacts.
+	update();
+
+	LocalVector<GodotConstraint2D *> constraints;
+	_get_stateful_constraints_in_order(bodies, constraints);
+
+	uint32_t constraint_count = 0;
+	reader.read(constraint_count);
+	uint32_t constraint_index = 0;
+	for (uint32_t i = 0; i < constraint_count && !reader.has_failed(); i++) {
+		GodotConstraint2D::OrderKey key;
+		uint32_t size = 0;
+		reader.read(key.self);
+		reader.read(key.object_A);
+		reader.read(key.object_B);
+		reader.read(key.sub);
+		reader.read(size);
+		GodotStateReader2D record(reader.get_ptr(), size);
+		reader.skip(size);
+		if (reader.has_failed()) {
+			break;
+		}
+
+		// Constraints that didn't exist when the state was saved start over.
+		while (constraint_index < constraints.size() && constraints[constraint_index]->get_order_key() < key) {
+			constraints[constraint_index++]->clear_step_state();
+		}
+		if (constraint_index < constraints.size() && constraints[constraint_index]->get_order_key() == key) {
+			constraints[constraint_index++]->restore_step_state(record);
+		}
+	}
+	while (constraint_index < constraints.size()) {
+		constraints[constraint_index++]->clear_step_state();
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_failed() || !reader.is_at_end(), ERR_INVALID_DATA, "Invalid physics space state.");
+
+	return OK;
+}
+
 void GodotSpace2D::body_add_to_state_query_list(SelfList<GodotBody2D> *p_body) {
 	state_query_list.add(p_body);
 }
@@ -1226,6 +1388,7 @@ GodotSpace2D::GodotSpace2D() {
 	contact_max_allowed_penetration = GLOBAL_GET("physics/2d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/2d/solver/default_contact_bias");
 	constraint_bias = GLOBAL_GET("physics/2d/solver/default_constraint_bias");
+	deterministic = GLOBAL_GET("physics/2d/solver/deterministic");
 
 	broadphase = GodotBroadPhase2D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
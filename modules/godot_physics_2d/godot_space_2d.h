@@ -111,6 +111,7 @@ private:
 	real_t body_time_to_sleep = 0.0;
 
 	bool locked = false;
+	bool deterministic = false;
 
 	real_t last_step = 0.001;
 
@@ -123,6 +124,12 @@ private:
 	Vector<Vector2> contact_debug;
 	int contact_debug_count = 0;
 
+	// Reused between calls to save_state(), to avoid reallocating every frame.
+	LocalVector<uint8_t> state_buffer;
+
+	void _get_bodies_in_order(LocalVector<GodotBody2D *> &r_bodies) const;
+	void _get_stateful_constraints_in_order(const LocalVector<GodotBody2D *> &p_bodies, LocalVector<GodotConstraint2D *> &r_constraints) const;
+
 	friend class GodotPhysicsDirectSpaceState2D;
 
 public:
@@ -177,6 +184,14 @@ public:
 	void set_param(PhysicsServer2D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer2D::SpaceParameter p_param) const;
 
+	// In deterministic mode, bodies and constraints are processed in an order that only depends
+	// on the objects involved, so that identical states step to identical results.
+	void set_deterministic(bool p_enabled) { deterministic = p_enabled; }
+	bool is_deterministic() const { return deterministic; }
+
+	Vector<uint8_t> save_state();
+	Error restore_state(const Vector<uint8_t> &p_state);
+
 	void set_island_count(int p_island_count) { island_count = p_island_count; }
 	int get_island_count() const { return island_count; }
 
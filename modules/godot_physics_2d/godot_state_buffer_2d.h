@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  godot_state_buffer_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+
+// Helpers for space state snapshots (see GodotSpace2D::save_state()).
+// Values are copied one by one rather than as whole structs, so snapshots
+// contain no uninitialized padding and can be hashed or compared directly.
+
+class GodotStateWriter2D {
+	LocalVector<uint8_t> &buffer;
+
+public:
+	template <typename T>
+	void write(const T &p_value) {
+		uint32_t offset = buffer.size();
+		buffer.resize(offset + sizeof(T));
+		memcpy(buffer.ptr() + offset, &p_value, sizeof(T));
+	}
+
+	uint32_t get_position() const { return buffer.size(); }
+
+	// Overwrites a value written earlier, e.g. a size only known after writing what follows it.
+	template <typename T>
+	void write_at(uint32_t p_position, const T &p_value) {
+		DEV_ASSERT(p_position + sizeof(T) <= buffer.size());
+		memcpy(buffer.ptr() + p_position, &p_value, sizeof(T));
+	}
+
+	GodotStateWriter2D(LocalVector<uint8_t> &p_buffer) :
+			buffer(p_buffer) {}
+};
+
+class GodotStateReader2D {
+	const uint8_t *ptr = nullptr;
+	const uint8_t *end = nullptr;
+	bool failed = false;
+
+public:
+	// Reading past the end sets the failed flag and leaves the value untouched.
+	template <typename T>
+	void read(T &r_value) {
+		if (failed || (size_t)(end - ptr) < sizeof(T)) {
+			failed = true;
+			return;
+		}
+		memcpy(&r_value, ptr, sizeof(T));
+		ptr += sizeof(T);
+	}
+
+	void skip(uint32_t p_size) {
+		if (failed || (size_t)(end - ptr) < p_size) {
+			failed = true;
+			return;
+		}
+		ptr += p_size;
+	}
+
+	const uint8_t *get_ptr() const { return ptr; }
+	bool is_at_end() const { return ptr == end; }
+	bool has_failed() const { return failed; }
+
+	GodotStateReader2D(const uint8_t *p_data, uint32_t p_size) :
+			ptr(p_data), end(p_data + p_size) {}
+};
@@ -40,6 +40,18 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+struct _ActiveBodyOrder2D {
+	_FORCE_INLINE_ bool operator()(const GodotBody2D *p_a, const GodotBody2D *p_b) const {
+		return p_a->get_self() < p_b->get_self();
+	}
+};
+
+struct _ConstraintOrder2D {
+	_FORCE_INLINE_ bool operator()(const GodotConstraint2D *p_a, const GodotConstraint2D *p_b) const {
+		return p_a->get_order_key() < p_b->get_order_key();
+	}
+};
+
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -145,13 +157,21 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	int active_count = 0;
 
+	active_bodies.clear();
 	const SelfList<GodotBody2D> *b = body_list->first();
 	while (b) {
 		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
 		active_count++;
 	}
 
+	const bool deterministic = p_space->is_deterministic();
+	if (deterministic) {
+		// The active list is ordered by when bodies were woken up, use an order that only depends on the bodies.
+		active_bodies.sort_custom<_ActiveBodyOrder2D>();
+	}
+
 	p_space->set_active_objects(active_count);
 
 	// Update the broadphase to register collision pairs.
@@ -193,13 +213,9 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
-
 	uint32_t body_island_count = 0;
 
-	while (b) {
-		GodotBody2D *body = b->self();
-
+	for (GodotBody2D *body : active_bodies) {
 		if (body->get_island_step() != _step) {
 			++body_island_count;
 			if (body_islands.size() < body_island_count) {
@@ -225,9 +241,12 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 			if (constraint_island.is_empty()) {
 				--island_count;
+			} else if (deterministic) {
+				// Constraints are found in the order they were created in, which depends on the history of the space.
+				// The order matters as the solver applies impulses sequentially.
+				constraint_island.sort_custom<_ConstraintOrder2D>();
 			}
 		}
-		b = b->next();
 	}
 
 	p_space->set_island_count((int)island_count);
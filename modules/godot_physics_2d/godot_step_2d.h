@@ -40,6 +40,7 @@ class GodotStep2D {
 	int iterations = 0;
 	real_t delta = 0.0;
 
+	LocalVector<GodotBody2D *> active_bodies;
 	LocalVector<LocalVector<GodotBody2D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
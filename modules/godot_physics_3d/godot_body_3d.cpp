@@ -179,6 +179,9 @@ void GodotBody3D::set_active(bool p_active) {
 	active = p_active;
 
 	if (active) {
+		if (suspended_list.in_list()) {
+			get_space()->body_remove_from_suspended_list(&suspended_list);
+		}
 		if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 			// Static bodies can't be active.
 			active = false;
@@ -190,6 +193,15 @@ void GodotBody3D::set_active(bool p_active) {
 	}
 }
 
+void GodotBody3D::suspend() {
+	ERR_FAIL_NULL(get_space());
+	if (!active) {
+		return;
+	}
+	set_active(false);
+	get_space()->body_add_to_suspended_list(&suspended_list);
+}
+
 void GodotBody3D::set_param(PhysicsServer3D::BodyParameter p_param, const Variant &p_value) {
 	switch (p_param) {
 		case PhysicsServer3D::BODY_PARAM_BOUNCE: {
@@ -449,6 +461,11 @@ void GodotBody3D::set_space(GodotSpace3D *p_space) {
 		if (direct_state_query_list.in_list()) {
 			get_space()->body_remove_from_state_query_list(&direct_state_query_list);
 		}
+		if (suspended_list.in_list()) {
+			// Suspension only applies to the regions of the previous space.
+			get_space()->body_remove_from_suspended_list(&suspended_list);
+			active = true;
+		}
 	}
 
 	_set_space(p_space);
@@ -708,6 +725,10 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		return;
 	}
 
+	// Velocities are kept when continuous collision detection limits the motion, the collision is solved next step.
+	const real_t motion_step = p_step * ccd_motion_fraction;
+	ccd_motion_fraction = 1.0;
+
 	Vector3 total_angular_velocity = angular_velocity + biased_angular_velocity;
 
 	real_t ang_vel = total_angular_velocity.length();
@@ -715,7 +736,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 
 	if (!Math::is_zero_approx(ang_vel)) {
 		Vector3 ang_vel_axis = total_angular_velocity / ang_vel;
-		Basis rot(ang_vel_axis, ang_vel * p_step);
+		Basis rot(ang_vel_axis, ang_vel * motion_step);
 		Basis identity3(1, 0, 0, 0, 1, 0, 0, 0, 1);
 		transform_new.origin += ((identity3 - rot) * transform_new.basis).xform(center_of_mass_local);
 		transform_new.basis = rot * transform_new.basis;
@@ -729,7 +750,7 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		}
 	}*/
 
-	transform_new.origin += total_linear_velocity * p_step;
+	transform_new.origin += total_linear_velocity * motion_step;
 
 	_set_transform(transform_new);
 	_set_inv_transform(get_transform().inverse());
@@ -737,6 +758,43 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	_update_transform_dependent();
 }
 
+void GodotBody3D::save_step_state(GodotStateWriter3D &p_writer) const {
+	p_writer.write(get_transform());
+	p_writer.write(get_inv_transform());
+	p_writer.write(new_transform);
+	p_writer.write(linear_velocity);
+	p_writer.write(angular_velocity);
+	p_writer.write(prev_linear_velocity);
+	p_writer.write(prev_angular_velocity);
+	p_writer.write(applied_force);
+	p_writer.write(applied_torque);
+	p_writer.write(still_time);
+	p_writer.write(active);
+}
+
+void GodotBody3D::restore_step_state(GodotStateReader3D &p_reader) {
+	Transform3D state_transform;
+	Transform3D state_inv_transform;
+	p_reader.read(state_transform);
+	p_reader.read(state_inv_transform);
+	p_reader.read(new_transform);
+	p_reader.read(linear_velocity);
+	p_reader.read(angular_velocity);
+	p_reader.read(prev_linear_velocity);
+	p_reader.read(prev_angular_velocity);
+	p_reader.read(applied_force);
+	p_reader.read(applied_torque);
+	p_reader.read(still_time);
+	bool state_active = active;
+	p_reader.read(state_active);
+	ERR_FAIL_COND(p_reader.has_failed());
+
+	_set_transform(state_transform);
+	_set_inv_transform(state_inv_transform);
+	_update_transform_dependent();
+	set_active(state_active);
+}
+
 void GodotBody3D::wakeup_neighbours() {
 	for (const KeyValue<GodotConstraint3D *, int> &E : constraint_map) {
 		const GodotConstraint3D *c = E.key;
@@ -828,7 +886,8 @@ GodotBody3D::GodotBody3D() :
 		GodotCollisionObject3D(TYPE_BODY),
 		active_list(this),
 		mass_properties_update_list(this),
-		direct_state_query_list(this) {
+		direct_state_query_list(this),
+		suspended_list(this) {
 	_set_static(false);
 }
 
@@ -32,6 +32,7 @@
 
 #include "godot_area_3d.h"
 #include "godot_collision_object_3d.h"
+#include "godot_state_buffer_3d.h"
 
 #include "core/templates/vset.h"
 
@@ -98,12 +99,14 @@ class GodotBody3D : public GodotCollisionObject3D {
 	SelfList<GodotBody3D> active_list;
 	SelfList<GodotBody3D> mass_properties_update_list;
 	SelfList<GodotBody3D> direct_state_query_list;
+	SelfList<GodotBody3D> suspended_list;
 
 	VSet<RID> exceptions;
 	bool omit_force_integration = false;
 	bool active = true;
 
 	bool continuous_cd = false;
+	real_t ccd_motion_fraction = 1.0;
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
 
@@ -282,6 +285,10 @@ public:
 	void set_active(bool p_active);
 	_FORCE_INLINE_ bool is_active() const { return active; }
 
+	// Deactivates the body until it's woken up or an active region of the space covers it again.
+	void suspend();
+	_FORCE_INLINE_ bool is_suspended() const { return suspended_list.in_list(); }
+
 	_FORCE_INLINE_ void wakeup() {
 		if ((!get_space()) || mode == PhysicsServer3D::BODY_MODE_STATIC || mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
 			return;
@@ -301,6 +308,9 @@ public:
 	_FORCE_INLINE_ void set_continuous_collision_detection(bool p_enable) { continuous_cd = p_enable; }
 	_FORCE_INLINE_ bool is_continuous_collision_detection_enabled() const { return continuous_cd; }
 
+	// Part of the motion done by the next call to integrate_velocities(), to stop before going through other bodies.
+	_FORCE_INLINE_ void set_ccd_motion_fraction(real_t p_fraction) { ccd_motion_fraction = p_fraction; }
+
 	void set_space(GodotSpace3D *p_space) override;
 
 	void update_mass_properties();
@@ -318,6 +328,10 @@ public:
 	void integrate_forces(real_t p_step);
 	void integrate_velocities(real_t p_step);
 
+	// Transform, velocities and sleep state, as saved and restored with the space state.
+	void save_step_state(GodotStateWriter3D &p_writer) const;
+	void restore_step_state(GodotStateReader3D &p_reader);
+
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
 	}
@@ -159,95 +159,62 @@ void GodotBodyPair3D::validate_contacts() {
 	}
 }
 
-// `_test_ccd` prevents tunneling by slowing down a high velocity body that is about to collide so
-// that next frame it will be at an appropriate location to collide (i.e. slight overlap).
-// WARNING: The way velocity is adjusted down to cause a collision means the momentum will be
-// weaker than it should for a bounce!
-// Process: Only proceed if body A's motion is high relative to its size.
-// Cast forward along motion vector to see if A is going to enter/pass B's collider next frame, only proceed if it does.
-// Adjust the velocity of A down so that it will just slightly intersect the collider instead of blowing right past it.
-bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
-	GodotShape3D *shape_A_ptr = p_A->get_shape(p_shape_A);
-
-	Vector3 motion = p_A->get_linear_velocity() * p_step;
-	real_t mlen = motion.length();
-	if (mlen < CMP_EPSILON) {
-		return false;
+// Prevents tunneling of a fast body through the other body of the pair, which is otherwise possible when it
+// moves past it in a single step. Called once velocities are solved, for pairs that didn't collide yet.
+// Process: Only proceed if the body's motion is high relative to its size.
+// Find when it first gets close to the other body with conservative advancement, taking rotation into account.
+// Return the part of the motion that brings it just within the other body, so contacts are found next step.
+// The body's velocity is left as is, so it hits the other body with its full momentum.
+real_t GodotBodyPair3D::get_ccd_motion_fraction(const GodotBody3D *p_body, real_t p_step) const {
+	if (!check_ccd) {
+		return 1.0;
 	}
 
-	Vector3 mnormal = motion / mlen;
+	const bool is_A = p_body == A;
+	if (!(is_A ? collide_A : collide_B)) {
+		return 1.0;
+	}
 
-	real_t min = 0.0, max = 0.0;
-	shape_A_ptr->project_range(mnormal, p_xform_A, min, max);
+	const GodotBody3D *other = is_A ? B : A;
+	const GodotShape3D *shape_ptr = p_body->get_shape(is_A ? shape_A : shape_B);
+	const GodotShape3D *other_shape_ptr = other->get_shape(is_A ? shape_B : shape_A);
 
-	// Did it move enough in this direction to even attempt raycast?
-	// Let's say it should move more than 1/3 the size of the object in that axis.
-	bool fast_object = mlen > (max - min) * 0.3;
-	if (!fast_object) {
-		return false; // moving slow enough that there's no chance of tunneling.
-	}
+	// Same velocities as used to integrate the transforms, relative to the other body.
+	const Vector3 motion = (p_body->get_linear_velocity() + p_body->get_biased_linear_velocity() - other->get_linear_velocity() - other->get_biased_linear_velocity()) * p_step;
+	const Vector3 rotation = (p_body->get_angular_velocity() + p_body->get_biased_angular_velocity()) * p_step;
 
-	// A is moving fast enough that tunneling might occur. See if it's really about to collide.
-
-	// Roughly predict body B's position in the next frame (ignoring collisions).
-	Transform3D predicted_xform_B = p_xform_B.translated(p_B->get_linear_velocity() * p_step);
-
-	// Support points are the farthest forward points on A in the direction of the motion vector.
-	// i.e. the candidate points of which one should hit B first if any collision does occur.
-	static const int max_supports = 16;
-	Vector3 supports_A[max_supports];
-	int support_count_A;
-	GodotShape3D::FeatureType support_type_A;
-	// Convert mnormal into body A's local xform because get_supports requires (and returns) local coordinates.
-	shape_A_ptr->get_supports(p_xform_A.basis.xform_inv(mnormal).normalized(), max_supports, supports_A, support_count_A, support_type_A);
-
-	// Cast a segment from each support point of A in the motion direction.
-	int segment_support_idx = -1;
-	float segment_hit_length = FLT_MAX;
-	Vector3 segment_hit_local;
-	for (int i = 0; i < support_count_A; i++) {
-		supports_A[i] = p_xform_A.xform(supports_A[i]);
-
-		Vector3 from = supports_A[i];
-		Vector3 to = from + motion;
-
-		Transform3D from_inv = predicted_xform_B.affine_inverse();
-
-		// Back up 10% of the per-frame motion behind the support point and use that as the beginning of our cast.
-		// At high speeds, this may mean we're actually casting from well behind the body instead of inside it, which is odd.
-		// But it still works out.
-		Vector3 local_from = from_inv.xform(from - motion * 0.1);
-		Vector3 local_to = from_inv.xform(to);
-
-		Vector3 rpos, rnorm;
-		int fi = -1;
-		if (p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm, fi, true)) {
-			float hit_length = local_from.distance_to(rpos);
-			if (hit_length < segment_hit_length) {
-				segment_support_idx = i;
-				segment_hit_length = hit_length;
-				segment_hit_local = rpos;
-			}
-		}
-	}
+	// Use coordinates local to the body to avoid numerical issues, like for collision detection.
+	const Vector3 &offset = p_body->get_transform().get_origin();
+	const Transform3D xform = Transform3D(p_body->get_transform().basis, Vector3()) * p_body->get_shape_transform(is_A ? shape_A : shape_B);
+	Transform3D other_xform = other->get_transform();
+	other_xform.origin -= offset;
+	other_xform = other_xform * other->get_shape_transform(is_A ? shape_B : shape_A);
 
-	if (segment_support_idx == -1) {
-		// There was no hit. Since the segment is the length of per-frame motion, this means the bodies will not
-		// actually collide yet on next frame. We'll probably check again next frame once they're closer.
-		return false;
+	// Did it move enough to even attempt it? Let's say more than 1/3 the size of the object in that direction.
+	const real_t mlen = motion.length();
+	real_t min = 0.0, max = 0.0;
+	if (mlen > CMP_EPSILON) {
+		shape_ptr->project_range(motion / mlen, xform, min, max);
+	}
+	if (mlen <= (max - min) * 0.3) {
+		return 1.0; // Moving slow enough that there's no chance of tunneling.
 	}
 
-	Vector3 hitpos = predicted_xform_B.xform(segment_hit_local);
+	const real_t max_penetration = space->get_contact_max_allowed_penetration();
 
-	real_t newlen = hitpos.distance_to(supports_A[segment_support_idx]);
-	// Adding 1% of body length to the distance between collision and support point
-	// should cause body A's support point to arrive just within B's collider next frame.
-	newlen += (max - min) * 0.01;
-	// FIXME: This doesn't always work well when colliding with a triangle face of a trimesh shape.
+	real_t fraction = 1.0;
+	Vector3 normal;
+	if (!GodotCollisionSolver3D::solve_time_of_impact(shape_ptr, xform, p_body->get_center_of_mass(), motion, rotation, other_shape_ptr, other_xform, max_penetration * 0.5, fraction, normal)) {
+		return 1.0;
+	}
 
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+	// Go slightly within the other body rather than stopping right before it.
+	const real_t closing_motion = motion.dot(normal);
+	if (closing_motion <= CMP_EPSILON) {
+		return 1.0; // Only rotating towards it, which can't cause tunneling by itself.
+	}
 
-	return true;
+	return MIN(fraction + max_penetration / closing_motion, (real_t)1.0);
 }
 
 real_t combine_bounce(GodotBody3D *A, GodotBody3D *B) {
@@ -315,24 +282,6 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 bool GodotBodyPair3D::pre_solve(real_t p_step) {
 	if (!collided) {
-		if (check_ccd) {
-			const Vector3 &offset_A = A->get_transform().get_origin();
-			Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
-			Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
-
-			Transform3D xform_Bu = B->get_transform();
-			xform_Bu.origin -= offset_A;
-			Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
-
-			if (A->is_continuous_collision_detection_enabled() && collide_A) {
-				_test_ccd(p_step, A, shape_A, xform_A, B, shape_B, xform_B);
-			}
-
-			if (B->is_continuous_collision_detection_enabled() && collide_B) {
-				_test_ccd(p_step, B, shape_B, xform_B, A, shape_A, xform_A);
-			}
-		}
-
 		return false;
 	}
 
@@ -595,6 +544,71 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+GodotConstraint3D::OrderKey GodotBodyPair3D::get_order_key() const {
+	// Which body is A follows the broadphase, pairs paired the other way around after a restore start over.
+	OrderKey key;
+	key.object_A = A->get_self().get_id();
+	key.object_B = B->get_self().get_id();
+	key.sub = ((uint64_t)shape_A << 32) | (uint32_t)shape_B;
+	return key;
+}
+
+void GodotBodyPair3D::save_step_state(GodotStateWriter3D &p_writer) const {
+	p_writer.write(sep_axis);
+	p_writer.write(collided);
+	p_writer.write(contact_count);
+	for (int i = 0; i < contact_count; i++) {
+		const Contact &c = contacts[i];
+		p_writer.write(c.position);
+		p_writer.write(c.normal);
+		p_writer.write(c.index_A);
+		p_writer.write(c.index_B);
+		p_writer.write(c.local_A);
+		p_writer.write(c.local_B);
+		p_writer.write(c.acc_impulse);
+		p_writer.write(c.acc_normal_impulse);
+		p_writer.write(c.acc_tangent_impulse);
+		p_writer.write(c.acc_bias_impulse);
+		p_writer.write(c.acc_bias_impulse_center_of_mass);
+		p_writer.write(c.used);
+	}
+}
+
+void GodotBodyPair3D::restore_step_state(GodotStateReader3D &p_reader) {
+	clear_step_state();
+
+	p_reader.read(sep_axis);
+	p_reader.read(collided);
+	int count = 0;
+	p_reader.read(count);
+	ERR_FAIL_COND(count < 0 || count > MAX_CONTACTS);
+	for (int i = 0; i < count; i++) {
+		Contact &c = contacts[i];
+		p_reader.read(c.position);
+		p_reader.read(c.normal);
+		p_reader.read(c.index_A);
+		p_reader.read(c.index_B);
+		p_reader.read(c.local_A);
+		p_reader.read(c.local_B);
+		p_reader.read(c.acc_impulse);
+		p_reader.read(c.acc_normal_impulse);
+		p_reader.read(c.acc_tangent_impulse);
+		p_reader.read(c.acc_bias_impulse);
+		p_reader.read(c.acc_bias_impulse_center_of_mass);
+		p_reader.read(c.used);
+	}
+	contact_count = count;
+}
+
+void GodotBodyPair3D::clear_step_state() {
+	for (int i = 0; i < MAX_CONTACTS; i++) {
+		contacts[i] = Contact();
+	}
+	contact_count = 0;
+	sep_axis = Vector3();
+	collided = false;
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
 		GodotBodyContact3D(_arr, 2) {
 	A = p_A;
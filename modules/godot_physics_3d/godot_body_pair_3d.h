@@ -101,13 +101,23 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
 
 	void validate_contacts();
-	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	virtual OrderKey get_order_key() const override;
+
+	virtual bool is_body_pair() const override { return true; }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	real_t get_ccd_motion_fraction(const GodotBody3D *p_body, real_t p_step) const;
+
+	virtual bool has_step_state() const override { return true; }
+	virtual void save_step_state(GodotStateWriter3D &p_writer) const override;
+	virtual void restore_step_state(GodotStateReader3D &p_reader) override;
+	virtual void clear_step_state() override;
+
 	GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B);
 	~GodotBodyPair3D();
 };
@@ -115,7 +115,7 @@ void GodotBroadPhase3DBVH::set_unpair_callback(UnpairCallback p_unpair_callback,
 }
 
 void GodotBroadPhase3DBVH::update() {
-	bvh.update();
+	bvh.update_threaded();
 }
 
 GodotBroadPhase3D *GodotBroadPhase3DBVH::_create() {
@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include "godot_state_buffer_3d.h"
+
+#include "core/templates/rid.h"
+
 class GodotBody3D;
 class GodotSoftBody3D;
 
@@ -52,6 +56,31 @@ protected:
 	}
 
 public:
+	// Identifies a constraint by what it connects rather than by when it was created.
+	// Used to match constraints when restoring a space state.
+	struct OrderKey {
+		uint64_t self = 0;
+		uint64_t object_A = 0;
+		uint64_t object_B = 0;
+		uint64_t sub = 0;
+
+		bool operator==(const OrderKey &p_key) const {
+			return self == p_key.self && object_A == p_key.object_A && object_B == p_key.object_B && sub == p_key.sub;
+		}
+		bool operator<(const OrderKey &p_key) const {
+			if (self != p_key.self) {
+				return self < p_key.self;
+			}
+			if (object_A != p_key.object_A) {
+				return object_A < p_key.object_A;
+			}
+			if (object_B != p_key.object_B) {
+				return object_B < p_key.object_B;
+			}
+			return sub < p_key.sub;
+		}
+	};
+
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
@@ -70,9 +99,25 @@ public:
 	_FORCE_INLINE_ void disable_collisions_between_bodies(const bool p_disabled) { disabled_collisions_between_bodies = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
+	// Joints are identified by their RID, contacts override this with the bodies and shapes involved.
+	virtual OrderKey get_order_key() const {
+		OrderKey key;
+		key.self = self.get_id();
+		return key;
+	}
+
+	// Contacts between two rigid bodies.
+	virtual bool is_body_pair() const { return false; }
+
 	virtual bool setup(real_t p_step) = 0;
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
+	// State carried over from one step to the next, like accumulated impulses used for warm starting.
+	virtual bool has_step_state() const { return false; }
+	virtual void save_step_state(GodotStateWriter3D &p_writer) const {}
+	virtual void restore_step_state(GodotStateReader3D &p_reader) {}
+	virtual void clear_step_state() {}
+
 	virtual ~GodotConstraint3D() {}
 };
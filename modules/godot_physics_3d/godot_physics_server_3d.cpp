@@ -214,6 +214,26 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+Vector<uint8_t> GodotPhysicsServer3D::space_save_state(RID p_space) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG((using_threads && !doing_sync) || space->is_locked(), Vector<uint8_t>(), "Space state is inaccessible right now, wait for iteration or physics process notification.");
+	return space->save_state();
+}
+
+Error GodotPhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG((using_threads && !doing_sync) || space->is_locked(), ERR_LOCKED, "Space state is inaccessible right now, wait for iteration or physics process notification.");
+	return space->restore_state(p_state);
+}
+
+void GodotPhysicsServer3D::space_set_active_regions(RID p_space, const Vector<AABB> &p_regions) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+	space->set_active_regions(p_regions);
+}
+
 RID GodotPhysicsServer3D::area_create() {
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -1638,11 +1658,21 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	step_time = 0;
+	broad_phase_time = 0;
+	narrow_phase_time = 0;
+	solver_time = 0;
+	integration_time = 0;
 	for (GodotSpace3D *E : active_spaces) {
 		stepper->step(E, p_step);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
+		step_time += E->get_process_info(INFO_STEP_TIME);
+		broad_phase_time += E->get_process_info(INFO_BROAD_PHASE_TIME);
+		narrow_phase_time += E->get_process_info(INFO_NARROW_PHASE_TIME);
+		solver_time += E->get_process_info(INFO_SOLVER_TIME);
+		integration_time += E->get_process_info(INFO_INTEGRATION_TIME);
 	}
 }
 
@@ -1659,9 +1689,13 @@ void GodotPhysicsServer3D::flush_queries() {
 
 	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
 
+	state_sync_time = 0;
+	area_callback_time = 0;
 	for (GodotSpace3D *E : active_spaces) {
 		GodotSpace3D *space = E;
 		space->call_queries();
+		state_sync_time += space->get_process_info(INFO_STATE_SYNC_TIME);
+		area_callback_time += space->get_process_info(INFO_AREA_CALLBACK_TIME);
 	}
 
 	flushing_queries = false;
@@ -1670,10 +1704,13 @@ void GodotPhysicsServer3D::flush_queries() {
 		uint64_t total_time[GodotSpace3D::ELAPSED_TIME_MAX];
 		static const char *time_name[GodotSpace3D::ELAPSED_TIME_MAX] = {
 			"integrate_forces",
+			"broad_phase",
 			"generate_islands",
 			"setup_constraints",
 			"solve_constraints",
-			"integrate_velocities"
+			"integrate_velocities",
+			"state_sync",
+			"area_callbacks"
 		};
 
 		for (int i = 0; i < GodotSpace3D::ELAPSED_TIME_MAX; i++) {
@@ -1719,11 +1756,38 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_STEP_TIME: {
+			return step_time;
+		} break;
+		case INFO_BROAD_PHASE_TIME: {
+			return broad_phase_time;
+		} break;
+		case INFO_NARROW_PHASE_TIME: {
+			return narrow_phase_time;
+		} break;
+		case INFO_SOLVER_TIME: {
+			return solver_time;
+		} break;
+		case INFO_INTEGRATION_TIME: {
+			return integration_time;
+		} break;
+		case INFO_STATE_SYNC_TIME: {
+			return state_sync_time;
+		} break;
+		case INFO_AREA_CALLBACK_TIME: {
+			return area_callback_time;
+		} break;
 	}
 
 	return 0;
 }
 
+int GodotPhysicsServer3D::space_get_process_info(RID p_space, ProcessInfo p_info) {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, 0);
+	return space->get_process_info(p_info);
+}
+
 void GodotPhysicsServer3D::_update_shapes() {
 	while (pending_shape_update_list.first()) {
 		pending_shape_update_list.first()->self()->_shape_changed();
@@ -48,6 +48,15 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	int active_objects = 0;
 	int collision_pairs = 0;
 
+	// Summed over active spaces, in microseconds.
+	int step_time = 0;
+	int broad_phase_time = 0;
+	int narrow_phase_time = 0;
+	int solver_time = 0;
+	int integration_time = 0;
+	int state_sync_time = 0;
+	int area_callback_time = 0;
+
 	bool using_threads = false;
 	bool doing_sync = false;
 	bool flushing_queries = false;
@@ -116,6 +125,10 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) override;
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override;
+	virtual void space_set_active_regions(RID p_space, const Vector<AABB> &p_regions) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
@@ -376,6 +389,7 @@ public:
 	virtual bool is_flushing_queries() const override { return flushing_queries; }
 
 	int get_process_info(ProcessInfo p_info) override;
+	int space_get_process_info(RID p_space, ProcessInfo p_info) override;
 
 	GodotPhysicsServer3D(bool p_using_threads = false);
 	~GodotPhysicsServer3D() {}
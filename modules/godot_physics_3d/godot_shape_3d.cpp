@@ -33,6 +33,7 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/sort_array.h"
 
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
@@ -1346,15 +1347,28 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+void GodotConcavePolygonShape3D::_cull_segment(_SegmentCullParams *p_params) const {
+	const BVH *nodes = p_params->bvh;
+	const uint32_t node_count = bvh.size();
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
-	}
+	uint32_t node_index = 0;
+	while (node_index < node_count) {
+		const BVH &node = nodes[node_index];
+		const bool hit = _dequantize_aabb(node).intersects_segment(p_params->from, p_params->to);
+
+		if (!(node.index & BVH_LEAF)) {
+			// Go down into the children, or skip them.
+			node_index = hit ? node_index + 1 : node.index;
+			continue;
+		}
+		node_index++;
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+		if (!hit) {
+			continue;
+		}
+
+		const int face_index = node.index & ~BVH_LEAF;
+		const Face *f = &p_params->faces[face_index];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
@@ -1363,8 +1377,8 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 
 		Vector3 res;
 		Vector3 normal;
-		int face_index = params_bvh->face_index;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
+		int fi = face_index;
+		if (face->intersect_segment(p_params->from, p_params->to, res, normal, fi, true)) {
 			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
 			if ((d > 0) && (d < p_params->min_d)) {
 				p_params->min_d = d;
@@ -1374,13 +1388,6 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 				p_params->collisions++;
 			}
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
 	}
 }
 
@@ -1409,7 +1416,7 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	params.face = &face;
 
 	// cull
-	_cull_segment(0, &params);
+	_cull_segment(&params);
 
 	if (params.collisions > 0) {
 		r_result = params.result;
@@ -1429,38 +1436,38 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 	return Vector3();
 }
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+void GodotConcavePolygonShape3D::_cull(_CullParams *p_params) const {
+	const BVH *nodes = p_params->bvh;
+	const uint32_t node_count = bvh.size();
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
-	}
+	uint32_t node_index = 0;
+	while (node_index < node_count) {
+		const BVH &node = nodes[node_index];
+		const bool overlap = p_params->min[0] <= node.max[0] && p_params->max[0] >= node.min[0] &&
+				p_params->min[1] <= node.max[1] && p_params->max[1] >= node.min[1] &&
+				p_params->min[2] <= node.max[2] && p_params->max[2] >= node.min[2];
+
+		if (!(node.index & BVH_LEAF)) {
+			// Go down into the children, or skip them.
+			node_index = overlap ? node_index + 1 : node.index;
+			continue;
+		}
+		node_index++;
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
+		if (!overlap) {
+			continue;
+		}
+
+		const Face *f = &p_params->faces[node.index & ~BVH_LEAF];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
 		face->vertex[1] = p_params->vertices[f->indices[1]];
 		face->vertex[2] = p_params->vertices[f->indices[2]];
 		if (p_params->callback(p_params->userdata, face)) {
-			return true;
-		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
-		}
-
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
+			return;
 		}
 	}
-
-	return false;
 }
 
 void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
@@ -1469,7 +1476,10 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	// Quantization would clamp bounds outside of the shape, make sure they overlap it first.
+	if (!p_local_aabb.intersects_inclusive(get_aabb())) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1481,7 +1491,7 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	face.invert_backface_collision = p_invert_backface_collision;
 
 	_CullParams params;
-	params.aabb = local_aabb;
+	_quantize_aabb(p_local_aabb, params.min, params.max);
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
@@ -1490,7 +1500,7 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	params.userdata = p_userdata;
 
 	// cull
-	_cull(0, &params);
+	_cull(&params);
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1585,32 +1595,27 @@ _Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int
 }
 
 void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+	int idx = p_idx++;
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	_quantize_aabb(p_bvh_tree->aabb, p_bvh_array[idx].min, p_bvh_array[idx].max);
 
+	if (p_bvh_tree->face_index >= 0) {
+		p_bvh_array[idx].index = p_bvh_tree->face_index | BVH_LEAF;
 	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
+		// Children follow their parent.
+		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
 		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
+		p_bvh_array[idx].index = p_idx;
 	}
 
 	memdelete(p_bvh_tree);
 }
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
+	faces.clear();
+	vertices.clear();
+	bvh.clear();
+
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
 		configure(AABB());
@@ -1629,9 +1634,9 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 	faces.resize(src_face_count);
 	Face *facesw = faces.ptrw();
 
-	vertices.resize(src_face_count * 3);
-
-	Vector3 *verticesw = vertices.ptrw();
+	// Faces share their vertices with neighbors, only store each of them once.
+	LocalVector<Vector3> unique_vertices;
+	HashMap<Vector3, int> vertex_indices;
 
 	AABB _aabb;
 
@@ -1641,13 +1646,17 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		bvh_arrayw[i].aabb = face.get_aabb();
 		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
 		bvh_arrayw[i].face_index = i;
-		facesw[i].indices[0] = i * 3 + 0;
-		facesw[i].indices[1] = i * 3 + 1;
-		facesw[i].indices[2] = i * 3 + 2;
+		for (int j = 0; j < 3; j++) {
+			HashMap<Vector3, int>::Iterator E = vertex_indices.find(face.vertex[j]);
+			if (E) {
+				facesw[i].indices[j] = E->value;
+			} else {
+				facesw[i].indices[j] = unique_vertices.size();
+				vertex_indices.insert(face.vertex[j], unique_vertices.size());
+				unique_vertices.push_back(face.vertex[j]);
+			}
+		}
 		facesw[i].normal = face.get_plane().normal;
-		verticesw[i * 3 + 0] = face.vertex[0];
-		verticesw[i * 3 + 1] = face.vertex[1];
-		verticesw[i * 3 + 2] = face.vertex[2];
 		if (i == 0) {
 			_aabb = bvh_arrayw[i].aabb;
 		} else {
@@ -1655,10 +1664,21 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
+	vertices.resize(unique_vertices.size());
+	memcpy(vertices.ptrw(), unique_vertices.ptr(), unique_vertices.size() * sizeof(Vector3));
+
+	// Flat shapes have no size on some axis, everything quantizes to zero there.
+	bvh_origin = _aabb.position;
+	for (int i = 0; i < 3; i++) {
+		const bool has_size = _aabb.size[i] > CMP_EPSILON;
+		bvh_quantize_scale[i] = has_size ? UINT16_MAX / _aabb.size[i] : 0.0;
+		bvh_dequantize_scale[i] = has_size ? _aabb.size[i] / UINT16_MAX : 0.0;
+	}
+
 	int count = 0;
 	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
 
-	bvh.resize(count + 1);
+	bvh.resize(count);
 
 	BVH *bvh_arrayw2 = bvh.ptrw();
 
@@ -1691,6 +1711,14 @@ GodotConcavePolygonShape3D::GodotConcavePolygonShape3D() {
 /* HEIGHT MAP SHAPE */
 
 Vector<real_t> GodotHeightMapShape3D::get_heights() const {
+	Vector<real_t> heights;
+	heights.resize(width * depth);
+	real_t *w = heights.ptrw();
+	for (int z = 0; z < depth; z++) {
+		for (int x = 0; x < width; x++) {
+			w[z * width + x] = _get_height(x, z);
+		}
+	}
 	return heights;
 }
 
@@ -1770,39 +1798,34 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
-
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
-
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
+// Part of the segment within the AABB, as parameters along it.
+static bool _heightmap_clip_segment(const AABB &p_aabb, const Vector3 &p_begin, const Vector3 &p_end, real_t &r_enter, real_t &r_exit) {
+	const Vector3 dir = p_end - p_begin;
+	real_t enter = 0.0;
+	real_t exit = 1.0;
+	for (int i = 0; i < 3; i++) {
+		const real_t min = p_aabb.position[i];
+		const real_t max = p_aabb.position[i] + p_aabb.size[i];
+		if (dir[i] == 0.0) {
+			if (p_begin[i] < min || p_begin[i] > max) {
+				return false;
+			}
+			continue;
+		}
+		real_t t0 = (min - p_begin[i]) / dir[i];
+		real_t t1 = (max - p_begin[i]) / dir[i];
+		if (t0 > t1) {
+			SWAP(t0, t1);
+		}
+		enter = MAX(enter, t0);
+		exit = MIN(exit, t1);
+		if (enter > exit) {
+			return false;
+		}
 	}
-
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
+	r_enter = enter;
+	r_exit = exit;
+	return true;
 }
 
 template <typename ProcessFunction>
@@ -1946,8 +1969,75 @@ bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process,
 	return false;
 }
 
+AABB GodotHeightMapShape3D::_get_bounds_aabb(int p_level, int p_x, int p_z) const {
+	const int size = BOUNDS_CHUNK_SIZE << p_level;
+	const int x0 = p_x * size;
+	const int z0 = p_z * size;
+	const int x1 = MIN(x0 + size, width - 1);
+	const int z1 = MIN(z0 + size, depth - 1);
+	const Range &range = _get_bounds(p_level, p_x, p_z);
+	return AABB(Vector3(x0 - local_origin.x, range.min, z0 - local_origin.z), Vector3(x1 - x0, range.max - range.min, z1 - z0));
+}
+
+bool GodotHeightMapShape3D::_intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	// Slightly larger bounds, so segments still get through flat chunks.
+	static const real_t bounds_margin = 0.001;
+
+	if (p_level == 0) {
+		// Only walk the cells of the chunk along the part of the segment that's within its heights.
+		real_t enter = 0.0;
+		real_t exit = 0.0;
+		if (!_heightmap_clip_segment(_get_bounds_aabb(0, p_x, p_z).grow(bounds_margin), p_begin, p_end, enter, exit)) {
+			return false;
+		}
+		const Vector3 dir = p_end - p_begin;
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin + dir * enter, p_begin + dir * exit, width, depth, local_origin, r_point, r_normal);
+	}
+
+	// Children don't overlap horizontally, so visiting them in the order the segment enters them finds the closest hit first.
+	struct Child {
+		real_t enter = 0.0;
+		int x = 0;
+		int z = 0;
+	};
+	Child children[4];
+	int child_count = 0;
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	for (int j = 0; j < 2; j++) {
+		for (int i = 0; i < 2; i++) {
+			Child child;
+			child.x = p_x * 2 + i;
+			child.z = p_z * 2 + j;
+			if (child.x >= child_level.width || child.z >= child_level.depth) {
+				continue;
+			}
+
+			real_t exit = 0.0;
+			if (!_heightmap_clip_segment(_get_bounds_aabb(p_level - 1, child.x, child.z).grow(bounds_margin), p_begin, p_end, child.enter, exit)) {
+				continue;
+			}
+
+			int index = child_count++;
+			while (index > 0 && children[index - 1].enter > child.enter) {
+				children[index] = children[index - 1];
+				index--;
+			}
+			children[index] = child;
+		}
+	}
+
+	for (int i = 0; i < child_count; i++) {
+		if (_intersect_bounds_segment(p_level - 1, children[i].x, children[i].z, p_begin, p_end, r_point, r_normal)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const {
-	if (heights.is_empty()) {
+	if (height_chunks.is_empty()) {
 		return false;
 	}
 
@@ -1982,7 +2072,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_levels.size() < 2) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1992,15 +2082,8 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			// Plus 1 here to width and depth of the chunk because _intersect_grid_segment() is used by cell level as well,
-			// and in _intersect_grid_segment() the loop will exit 1 early because for cell point triangle lookup, it dose x + 1, z + 1 etc for the vertex.
-			int bounds_width = bounds_grid_width + 1;
-			int bounds_depth = bounds_grid_depth + 1;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_width, bounds_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, go down the accelerator to skip the parts of the heightmap it passes above or below.
+			return _intersect_bounds_segment(bounds_levels.size() - 1, 0, 0, p_begin, p_end, r_point, r_normal);
 		}
 	}
 
@@ -2028,8 +2111,63 @@ void GodotHeightMapShape3D::_get_cell(const Vector3 &p_point, int &r_x, int &r_y
 	r_z = (clamped_point.z < 0.0) ? (clamped_point.z - 0.5) : (clamped_point.z + 0.5);
 }
 
+bool GodotHeightMapShape3D::_cull_bounds(int p_level, int p_x, int p_z, const AABB &p_local_aabb, int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const {
+	// Cells of this node within the queried range.
+	const int size = BOUNDS_CHUNK_SIZE << p_level;
+	const int start_x = MAX(p_x * size, p_start_x);
+	const int end_x = MIN((p_x + 1) * size, p_end_x);
+	const int start_z = MAX(p_z * size, p_start_z);
+	const int end_z = MIN((p_z + 1) * size, p_end_z);
+	if (start_x >= end_x || start_z >= end_z) {
+		return false;
+	}
+
+	// Skip nodes entirely above or below the AABB.
+	const Range &range = _get_bounds(p_level, p_x, p_z);
+	if (range.min > p_local_aabb.position.y + p_local_aabb.size.y || range.max < p_local_aabb.position.y) {
+		return false;
+	}
+
+	if (p_level > 0) {
+		const BoundsLevel &child_level = bounds_levels[p_level - 1];
+		for (int j = 0; j < 2; j++) {
+			for (int i = 0; i < 2; i++) {
+				const int x = p_x * 2 + i;
+				const int z = p_z * 2 + j;
+				if (x < child_level.width && z < child_level.depth && _cull_bounds(p_level - 1, x, z, p_local_aabb, start_x, end_x, start_z, end_z, p_face, p_callback, p_userdata)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	for (int z = start_z; z < end_z; z++) {
+		for (int x = start_x; x < end_x; x++) {
+			// First triangle.
+			_get_point(x, z, p_face.vertex[0]);
+			_get_point(x + 1, z, p_face.vertex[1]);
+			_get_point(x, z + 1, p_face.vertex[2]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
+			}
+
+			// Second triangle.
+			p_face.vertex[0] = p_face.vertex[1];
+			_get_point(x + 1, z + 1, p_face.vertex[1]);
+			p_face.normal = Plane(p_face.vertex[0], p_face.vertex[1], p_face.vertex[2]).normal;
+			if (p_callback(p_userdata, &p_face)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
-	if (heights.is_empty()) {
+	if (height_chunks.is_empty()) {
 		return;
 	}
 
@@ -2058,26 +2196,7 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
-
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
-		}
-	}
+	_cull_bounds(bounds_levels.size() - 1, 0, 0, p_local_aabb, start_x, end_x, start_z, end_z, face, p_callback, p_userdata);
 }
 
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -2090,34 +2209,123 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 			(p_mass / 3.0) * (extents.x * extents.x + extents.y * extents.y));
 }
 
-void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
+void GodotHeightMapShape3D::_compress_heights(const Vector<real_t> &p_heights) {
+	height_chunks.clear();
+	quantized_heights.clear();
+	full_heights.clear();
+
+	chunks_width = (width + BOUNDS_CHUNK_SIZE - 1) / BOUNDS_CHUNK_SIZE;
+	chunks_depth = (depth + BOUNDS_CHUNK_SIZE - 1) / BOUNDS_CHUNK_SIZE;
+	height_chunks.resize(chunks_width * chunks_depth);
+
+	const real_t *r = p_heights.ptr();
+	const uint32_t chunk_sample_count = BOUNDS_CHUNK_SIZE * BOUNDS_CHUNK_SIZE;
+
+	// Pick the storage of each chunk first, so the sample arrays are allocated at their exact size.
+	uint32_t quantized_count = 0;
+	uint32_t full_count = 0;
+	for (int cz = 0; cz < chunks_depth; ++cz) {
+		const int z0 = cz * BOUNDS_CHUNK_SIZE;
+		const int z_end = MIN(z0 + BOUNDS_CHUNK_SIZE, depth);
+		for (int cx = 0; cx < chunks_width; ++cx) {
+			const int x0 = cx * BOUNDS_CHUNK_SIZE;
+			const int x_end = MIN(x0 + BOUNDS_CHUNK_SIZE, width);
+
+			real_t min = r[z0 * width + x0];
+			real_t max = min;
+			for (int z = z0; z < z_end; ++z) {
+				for (int x = x0; x < x_end; ++x) {
+					min = MIN(min, r[z * width + x]);
+					max = MAX(max, r[z * width + x]);
+				}
+			}
 
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
+			HeightChunk &chunk = height_chunks[cz * chunks_width + cx];
+			chunk.min = min;
+			if (max == min) {
+				chunk.step = 0.0;
+				continue;
+			}
+
+			// Same computation as _get_height(), so the error is exactly the one of the stored samples.
+			chunk.step = (max - min) / UINT16_MAX;
+			for (int z = z0; z < z_end && chunk.step > 0.0; ++z) {
+				for (int x = x0; x < x_end; ++x) {
+					const real_t height = r[z * width + x];
+					const uint16_t quantized = (uint16_t)CLAMP(Math::round((height - min) / chunk.step), (real_t)0.0, (real_t)UINT16_MAX);
+					if (Math::abs(min + chunk.step * quantized - height) > MAX_HEIGHT_ERROR) {
+						chunk.step = -1.0;
+						break;
+					}
+				}
+			}
 
-	if (width % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
+			if (chunk.step > 0.0) {
+				chunk.offset = quantized_count;
+				quantized_count += chunk_sample_count;
+			} else {
+				chunk.offset = full_count;
+				full_count += chunk_sample_count;
+			}
+		}
 	}
 
-	if (depth % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_depth;
+	// Samples past the edges of the heightmap are never read.
+	quantized_heights.resize(quantized_count);
+	full_heights.resize(full_count);
+	if (quantized_count > 0) {
+		memset(quantized_heights.ptr(), 0, quantized_count * sizeof(uint16_t));
+	}
+	if (full_count > 0) {
+		memset(full_heights.ptr(), 0, full_count * sizeof(real_t));
 	}
 
-	uint32_t bound_grid_size = (uint32_t)(bounds_grid_width * bounds_grid_depth);
+	for (int cz = 0; cz < chunks_depth; ++cz) {
+		const int z0 = cz * BOUNDS_CHUNK_SIZE;
+		const int z_end = MIN(z0 + BOUNDS_CHUNK_SIZE, depth);
+		for (int cx = 0; cx < chunks_width; ++cx) {
+			const int x0 = cx * BOUNDS_CHUNK_SIZE;
+			const int x_end = MIN(x0 + BOUNDS_CHUNK_SIZE, width);
 
-	if (bound_grid_size < 2) {
-		// Grid is empty or just one chunk.
+			const HeightChunk &chunk = height_chunks[cz * chunks_width + cx];
+			if (chunk.step == 0.0) {
+				continue;
+			}
+
+			for (int z = z0; z < z_end; ++z) {
+				for (int x = x0; x < x_end; ++x) {
+					const real_t height = r[z * width + x];
+					const uint32_t index = chunk.offset + (z - z0) * BOUNDS_CHUNK_SIZE + (x - x0);
+					if (chunk.step > 0.0) {
+						quantized_heights[index] = (uint16_t)CLAMP(Math::round((height - chunk.min) / chunk.step), (real_t)0.0, (real_t)UINT16_MAX);
+					} else {
+						full_heights[index] = height;
+					}
+				}
+			}
+		}
+	}
+}
+
+void GodotHeightMapShape3D::_build_accelerator() {
+	bounds_pyramid.clear();
+	bounds_levels.clear();
+
+	if (height_chunks.is_empty()) {
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
+	BoundsLevel level;
+	level.width = chunks_width;
+	level.depth = chunks_depth;
+	bounds_levels.push_back(level);
+	bounds_pyramid.resize(level.width * level.depth);
 
 	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
+	for (int cz = 0; cz < chunks_depth; ++cz) {
 		int z0 = cz * BOUNDS_CHUNK_SIZE;
 
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
+		for (int cx = 0; cx < chunks_width; ++cx) {
 			int x0 = cx * BOUNDS_CHUNK_SIZE;
 
 			Range r;
@@ -2154,16 +2362,45 @@ void GodotHeightMapShape3D::_build_accelerator() {
 				}
 			}
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+			bounds_pyramid[cx + cz * chunks_width] = r;
+		}
+	}
+
+	// Merge 2x2 nodes into the level above, until a single node covers everything.
+	while (level.width > 1 || level.depth > 1) {
+		BoundsLevel parent;
+		parent.offset = bounds_pyramid.size();
+		parent.width = (level.width + 1) / 2;
+		parent.depth = (level.depth + 1) / 2;
+		bounds_pyramid.resize(parent.offset + parent.width * parent.depth);
+
+		for (int z = 0; z < parent.depth; ++z) {
+			for (int x = 0; x < parent.width; ++x) {
+				Range r = bounds_pyramid[level.offset + (z * 2) * level.width + (x * 2)];
+				for (int j = 0; j < 2; ++j) {
+					for (int i = 0; i < 2; ++i) {
+						if (x * 2 + i < level.width && z * 2 + j < level.depth) {
+							const Range &child = bounds_pyramid[level.offset + (z * 2 + j) * level.width + (x * 2 + i)];
+							r.min = MIN(r.min, child.min);
+							r.max = MAX(r.max, child.max);
+						}
+					}
+				}
+				bounds_pyramid[parent.offset + z * parent.width + x] = r;
+			}
 		}
+
+		bounds_levels.push_back(parent);
+		level = parent;
 	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
-	heights = p_heights;
 	width = p_width;
 	depth = p_depth;
 
+	_compress_heights(p_heights);
+
 	// Initialize aabb.
 	AABB aabb_new;
 	aabb_new.position = Vector3(0.0, p_min_height, 0.0);
@@ -2233,9 +2470,9 @@ void GodotHeightMapShape3D::set_data(const Variant &p_data) {
 		min_height = d["min_height"];
 		max_height = d["max_height"];
 	} else {
-		int heights_size = heights.size();
+		int heights_size = heights_buffer.size();
 		for (int i = 0; i < heights_size; ++i) {
-			real_t h = heights[i];
+			real_t h = heights_buffer[i];
 			if (h < min_height) {
 				min_height = h;
 			} else if (h > max_height) {
@@ -2261,7 +2498,7 @@ Variant GodotHeightMapShape3D::get_data() const {
 	d["min_height"] = shape_aabb.position.y;
 	d["max_height"] = shape_aabb.position.y + shape_aabb.size.y;
 
-	d["heights"] = heights;
+	d["heights"] = get_heights();
 
 	return d;
 }
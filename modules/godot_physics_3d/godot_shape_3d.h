@@ -315,18 +315,39 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
+	// Bounds are quantized to 16 bits within the shape's AABB, rounded outwards. Nodes are stored depth first,
+	// so the first child of a node is the next node, and a subtree is skipped by jumping to the node after it.
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		uint32_t index = 0; // Face index for leaves, otherwise index of the node after this subtree.
 	};
 
+	static constexpr uint32_t BVH_LEAF = 1u << 31;
+
 	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_quantize_scale;
+	Vector3 bvh_dequantize_scale;
+
+	_FORCE_INLINE_ void _quantize_aabb(const AABB &p_aabb, uint16_t *r_min, uint16_t *r_max) const {
+		for (int i = 0; i < 3; i++) {
+			const real_t min = (p_aabb.position[i] - bvh_origin[i]) * bvh_quantize_scale[i];
+			const real_t max = (p_aabb.position[i] + p_aabb.size[i] - bvh_origin[i]) * bvh_quantize_scale[i];
+			r_min[i] = (uint16_t)CLAMP(Math::floor(min), (real_t)0.0, (real_t)UINT16_MAX);
+			r_max[i] = (uint16_t)CLAMP(Math::ceil(max), (real_t)0.0, (real_t)UINT16_MAX);
+		}
+	}
+
+	_FORCE_INLINE_ AABB _dequantize_aabb(const BVH &p_node) const {
+		const Vector3 min = Vector3(p_node.min[0], p_node.min[1], p_node.min[2]) * bvh_dequantize_scale;
+		const Vector3 max = Vector3(p_node.max[0], p_node.max[1], p_node.max[2]) * bvh_dequantize_scale;
+		return AABB(bvh_origin + min, max - min);
+	}
 
 	struct _CullParams {
-		AABB aabb;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
@@ -353,8 +374,8 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	void _cull_segment(_SegmentCullParams *p_params) const;
+	void _cull(_CullParams *p_params) const;
 
 	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
 
@@ -383,28 +404,58 @@ public:
 };
 
 struct GodotHeightMapShape3D : public GodotConcaveShape3D {
-	Vector<real_t> heights;
 	int width = 0;
 	int depth = 0;
 	Vector3 local_origin;
 
+	static const int BOUNDS_CHUNK_SIZE = 16;
+
+	// Heights are stored by chunks of BOUNDS_CHUNK_SIZE x BOUNDS_CHUNK_SIZE samples, quantized to 16 bits between the
+	// lowest and highest height of the chunk. Chunks where that would move a sample by more than MAX_HEIGHT_ERROR keep
+	// full precision, and flat chunks don't store samples at all.
+	static constexpr real_t MAX_HEIGHT_ERROR = 0.001;
+
+	struct HeightChunk {
+		real_t min = 0.0;
+		real_t step = 0.0; // Height of a quantization step, zero for flat chunks, negative for full precision chunks.
+		uint32_t offset = 0; // Index of the first sample in `quantized_heights` or `full_heights`.
+	};
+	TightLocalVector<HeightChunk> height_chunks;
+	TightLocalVector<uint16_t> quantized_heights;
+	TightLocalVector<real_t> full_heights;
+	int chunks_width = 0;
+	int chunks_depth = 0;
+
 	// Accelerator.
 	struct Range {
 		real_t min = 0.0;
 		real_t max = 0.0;
 	};
-	LocalVector<Range> bounds_grid;
-	int bounds_grid_width = 0;
-	int bounds_grid_depth = 0;
 
-	static const int BOUNDS_CHUNK_SIZE = 16;
+	// Min and max heights of chunks, then of groups of 2x2 nodes of the level below, up to a single root node.
+	struct BoundsLevel {
+		uint32_t offset = 0;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<Range> bounds_pyramid;
+	LocalVector<BoundsLevel> bounds_levels;
 
-	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
-		return bounds_grid[(p_z * bounds_grid_width) + p_x];
+	_FORCE_INLINE_ const Range &_get_bounds(int p_level, int p_x, int p_z) const {
+		const BoundsLevel &level = bounds_levels[p_level];
+		return bounds_pyramid[level.offset + (p_z * level.width) + p_x];
 	}
 
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
-		return heights[(p_z * width) + p_x];
+		const HeightChunk &chunk = height_chunks[(p_z / BOUNDS_CHUNK_SIZE) * chunks_width + (p_x / BOUNDS_CHUNK_SIZE)];
+		if (chunk.step == 0.0) {
+			return chunk.min;
+		}
+		const uint32_t index = chunk.offset + (p_z % BOUNDS_CHUNK_SIZE) * BOUNDS_CHUNK_SIZE + (p_x % BOUNDS_CHUNK_SIZE);
+		if (chunk.step > 0.0) {
+			return chunk.min + chunk.step * quantized_heights[index];
+		}
+		return full_heights[index];
 	}
 
 	_FORCE_INLINE_ void _get_point(int p_x, int p_z, Vector3 &r_point) const {
@@ -413,12 +464,18 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 		r_point.z = p_z - 0.5 * (depth - 1.0);
 	}
 
+	// Bounds of a node of the accelerator, in local coordinates.
+	AABB _get_bounds_aabb(int p_level, int p_x, int p_z) const;
+
 	void _get_cell(const Vector3 &p_point, int &r_x, int &r_y, int &r_z) const;
 
+	void _compress_heights(const Vector<real_t> &p_heights);
 	void _build_accelerator();
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _cull_bounds(int p_level, int p_x, int p_z, const AABB &p_local_aabb, int p_start_x, int p_end_x, int p_start_z, int p_end_z, GodotFaceShape3D &p_face, QueryCallback p_callback, void *p_userdata) const;
 
 	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
 
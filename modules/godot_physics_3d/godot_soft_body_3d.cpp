@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering_server.h"
 
 // Based on Bullet soft body.
@@ -190,18 +191,13 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 	}
 }
 
-void GodotSoftBody3D::update_bounds() {
+bool GodotSoftBody3D::compute_bounds() {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
 
 	bounds = AABB();
 
 	const uint32_t nodes_count = nodes.size();
-	if (nodes_count == 0) {
-		deinitialize_shape();
-		return;
-	}
-
 	bool first = true;
 	bool moved = false;
 	for (uint32_t node_index = 0; node_index < nodes_count; ++node_index) {
@@ -217,11 +213,33 @@ void GodotSoftBody3D::update_bounds() {
 		}
 	}
 
+	return moved;
+}
+
+void GodotSoftBody3D::update_bounds() {
+	if (nodes.is_empty()) {
+		bounds = AABB();
+		deinitialize_shape();
+		return;
+	}
+
+	const bool moved = compute_bounds();
 	if (get_space()) {
 		initialize_shape(moved);
 	}
 }
 
+void GodotSoftBody3D::update_collision_shape() {
+	if (nodes.is_empty()) {
+		deinitialize_shape();
+		return;
+	}
+
+	if (get_space()) {
+		initialize_shape(bounds_moved);
+	}
+}
+
 void GodotSoftBody3D::update_constants() {
 	reset_link_rest_lengths();
 	update_link_constants();
@@ -581,6 +599,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	color_links();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -825,6 +844,61 @@ void GodotSoftBody3D::reoptimize_link_order() {
 	memdelete_arr(link_buffer);
 }
 
+void GodotSoftBody3D::color_links() {
+	link_color_offsets.clear();
+
+	const uint32_t link_count = links.size();
+	if (link_count == 0) {
+		return;
+	}
+
+	// Greedy coloring, each link takes the first color none of its nodes uses yet.
+	// Nodes rarely have more than a few dozen links, if one runs out of colors the links stay uncolored.
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	memset(node_colors.ptr(), 0, node_colors.size() * sizeof(uint64_t));
+
+	LocalVector<uint8_t> link_colors;
+	link_colors.resize(link_count);
+	uint32_t color_counts[64] = {};
+	uint32_t color_count = 0;
+
+	for (uint32_t i = 0; i < link_count; ++i) {
+		const uint32_t a = links[i].n[0]->index;
+		const uint32_t b = links[i].n[1]->index;
+		const uint64_t free_colors = ~(node_colors[a] | node_colors[b]);
+		if (free_colors == 0) {
+			return;
+		}
+
+		uint8_t color = 0;
+		while (!(free_colors & (uint64_t(1) << color))) {
+			color++;
+		}
+
+		node_colors[a] |= uint64_t(1) << color;
+		node_colors[b] |= uint64_t(1) << color;
+		link_colors[i] = color;
+		color_counts[color]++;
+		color_count = MAX(color_count, uint32_t(color) + 1);
+	}
+
+	// Sort links by color, keeping their optimized order within each color.
+	link_color_offsets.resize(color_count + 1);
+	link_color_offsets[0] = 0;
+	for (uint32_t color = 0; color < color_count; ++color) {
+		link_color_offsets[color + 1] = link_color_offsets[color] + color_counts[color];
+	}
+
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	LocalVector<uint32_t> next_link = link_color_offsets;
+	for (uint32_t i = 0; i < link_count; ++i) {
+		sorted_links[next_link[link_colors[i]]++] = links[i];
+	}
+	links = sorted_links;
+}
+
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
 	if (p_node1 == p_node2) {
 		return;
@@ -1044,8 +1118,8 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node.f = Vector3();
 	}
 
-	// Bounds and tree update.
-	update_bounds();
+	// Bounds and tree update, the shape is updated in update_collision_shape() since it involves the broadphase.
+	bounds_moved = compute_bounds();
 
 	// Node tree update.
 	for (const Node &node : nodes) {
@@ -1066,7 +1140,7 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_parallel_links) {
 	const real_t inv_delta = 1.0 / p_delta;
 
 	for (Link &link : links) {
@@ -1082,7 +1156,7 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	// Solve positions.
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
 		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+		solve_links(1.0, ti, p_parallel_links);
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
 	for (Node &node : nodes) {
@@ -1097,22 +1171,49 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	update_normals_and_centroids();
 }
 
-void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (Link &link : links) {
-		if (link.c0 > 0) {
-			Node &node_a = *link.n[0];
-			Node &node_b = *link.n[1];
-			const Vector3 del = node_b.x - node_a.x;
-			const real_t len = del.length_squared();
-			if (link.c1 + len > CMP_EPSILON) {
-				const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
-				node_a.x -= del * (k * node_a.im);
-				node_b.x += del * (k * node_b.im);
-			}
+void GodotSoftBody3D::solve_link(Link &p_link, real_t p_kst) {
+	if (p_link.c0 > 0) {
+		Node &node_a = *p_link.n[0];
+		Node &node_b = *p_link.n[1];
+		const Vector3 del = node_b.x - node_a.x;
+		const real_t len = del.length_squared();
+		if (p_link.c1 + len > CMP_EPSILON) {
+			const real_t k = ((p_link.c1 - len) / (p_link.c0 * (p_link.c1 + len))) * p_kst;
+			node_a.x -= del * (k * node_a.im);
+			node_b.x += del * (k * node_b.im);
 		}
 	}
 }
 
+void GodotSoftBody3D::solve_links(real_t kst, real_t ti, bool p_parallel) {
+	if (!p_parallel || !can_solve_links_in_parallel()) {
+		for (Link &link : links) {
+			solve_link(link, kst);
+		}
+		return;
+	}
+
+	// Colors are solved one after the other, in the same order as the single-threaded loop above.
+	for (uint32_t color = 0; color + 1 < link_color_offsets.size(); ++color) {
+		LinkRange range;
+		range.begin = link_color_offsets[color];
+		range.end = link_color_offsets[color + 1];
+		range.kst = kst;
+
+		const uint32_t block_count = (range.end - range.begin + LINK_BLOCK_SIZE - 1) / LINK_BLOCK_SIZE;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::_solve_link_block, (const LinkRange *)&range, block_count, -1, true, SNAME("Physics3DSoftBodySolveLinks"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+}
+
+void GodotSoftBody3D::_solve_link_block(uint32_t p_block_index, const LinkRange *p_range) {
+	const uint32_t begin = p_range->begin + p_block_index * LINK_BLOCK_SIZE;
+	const uint32_t end = MIN(begin + LINK_BLOCK_SIZE, p_range->end);
+	for (uint32_t i = begin; i < end; ++i) {
+		solve_link(links[i], p_range->kst);
+	}
+}
+
 struct AABBQueryResult {
 	const GodotSoftBody3D *soft_body = nullptr;
 	void *userdata = nullptr;
@@ -1220,6 +1321,7 @@ void GodotSoftBody3D::destroy() {
 
 	nodes.clear();
 	links.clear();
+	link_color_offsets.clear();
 	faces.clear();
 
 	bounds = AABB();
@@ -81,12 +81,27 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Links are sorted by color, links of the same color don't share any node and can be solved in parallel.
+	// Each color starts at the offset of its index, and ends at the offset of the next one.
+	LocalVector<uint32_t> link_color_offsets;
+
+	// Below this many links, solving them on multiple threads costs more than it saves.
+	static const uint32_t PARALLEL_LINK_COUNT_MIN = 32768;
+	static const uint32_t LINK_BLOCK_SIZE = 512;
+
+	struct LinkRange {
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		real_t kst = 0.0;
+	};
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
 	LocalVector<uint32_t> map_visual_to_physics;
 
 	AABB bounds;
+	bool bounds_moved = false;
 
 	real_t collision_margin = 0.05;
 
@@ -200,8 +215,12 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
+	// Thread-safe as long as each soft body is only processed by one thread, and update_collision_shape() is called after.
 	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	void update_collision_shape();
+
+	_FORCE_INLINE_ bool can_solve_links_in_parallel() const { return links.size() >= PARALLEL_LINK_COUNT_MIN && link_color_offsets.size() > 1; }
+	void solve_constraints(real_t p_delta, bool p_parallel_links = false);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -218,6 +237,7 @@ protected:
 
 private:
 	void update_normals_and_centroids();
+	bool compute_bounds();
 	void update_bounds();
 	void update_constants();
 	void update_area();
@@ -233,10 +253,13 @@ private:
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
 	void reoptimize_link_order();
+	void color_links();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
-	void solve_links(real_t kst, real_t ti);
+	_FORCE_INLINE_ void solve_link(Link &p_link, real_t p_kst);
+	void solve_links(real_t kst, real_t ti, bool p_parallel);
+	void _solve_link_block(uint32_t p_block_index, const LinkRange *p_range);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
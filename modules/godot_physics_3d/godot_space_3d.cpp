@@ -34,9 +34,14 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
+#define STATE_MAGIC 0x53335047 // "GP3S"
+#define STATE_VERSION 1
+
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
@@ -110,14 +115,18 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) const {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -127,22 +136,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_objects[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_subindices[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -219,29 +228,33 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 
 	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
 
+	return _intersect_shape(p_parameters, shape, p_parameters.transform, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_results, p_result_max);
+}
+
+int GodotPhysicsDirectSpaceState3D::_intersect_shape(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, const Transform3D &p_transform, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, ShapeResult *r_results, int p_result_max) const {
 	int cc = 0;
 
 	//Transform3D ai = p_xform.affine_inverse();
 
-	for (int i = 0; i < amount; i++) {
+	for (int i = 0; i < p_amount; i++) {
 		if (cc >= p_result_max) {
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
+		int shape_idx = p_subindices[i];
 
-		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
+		if (!GodotCollisionSolver3D::solve_static(p_shape, p_transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
 		}
 
@@ -262,6 +275,100 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+void GodotPhysicsDirectSpaceState3D::_add_batch_candidates(QueryBatch &r_batch, int p_amount) const {
+	const uint32_t offset = r_batch.objects.size();
+	r_batch.objects.resize(offset + p_amount);
+	r_batch.subindices.resize(offset + p_amount);
+	memcpy(r_batch.objects.ptr() + offset, space->intersection_query_results, p_amount * sizeof(GodotCollisionObject3D *));
+	memcpy(r_batch.subindices.ptr() + offset, space->intersection_query_subindex_results, p_amount * sizeof(int));
+	r_batch.offsets.push_back(offset + p_amount);
+}
+
+void GodotPhysicsDirectSpaceState3D::_run_query_batch(QueryBatch &p_batch, void (GodotPhysicsDirectSpaceState3D::*p_method)(uint32_t, QueryBatch *)) {
+	const int chunk_count = (p_batch.query_count + QUERY_BATCH_CHUNK_SIZE - 1) / QUERY_BATCH_CHUNK_SIZE;
+	if (chunk_count == 1) {
+		(this->*p_method)(0, &p_batch);
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, &p_batch, chunk_count, -1, true, SNAME("GodotPhysics3DQueryBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_rays_chunk(uint32_t p_chunk, QueryBatch *p_batch) {
+	const int begin = p_chunk * QUERY_BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + QUERY_BATCH_CHUNK_SIZE, p_batch->query_count);
+	for (int i = begin; i < end; i++) {
+		const uint32_t offset = p_batch->offsets[i];
+		p_batch->hits[i] = _intersect_ray(*p_batch->ray_parameters, p_batch->from[i], p_batch->to[i], p_batch->objects.ptr() + offset, p_batch->subindices.ptr() + offset, p_batch->offsets[i + 1] - offset, p_batch->ray_results[i]);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_shapes_chunk(uint32_t p_chunk, QueryBatch *p_batch) {
+	const int begin = p_chunk * QUERY_BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + QUERY_BATCH_CHUNK_SIZE, p_batch->query_count);
+	for (int i = begin; i < end; i++) {
+		const uint32_t offset = p_batch->offsets[i];
+		p_batch->result_counts[i] = _intersect_shape(*p_batch->shape_parameters, p_batch->shape, p_batch->transforms[i], p_batch->objects.ptr() + offset, p_batch->subindices.ptr() + offset, p_batch->offsets[i + 1] - offset, p_batch->shape_results + i * p_batch->result_max, p_batch->result_max);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND(space->locked);
+	if (p_ray_count <= 0) {
+		return;
+	}
+
+	// The broad phase shares its cull buffers, so it is queried here and only the narrow phase runs on worker threads.
+	QueryBatch batch;
+	batch.ray_parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.ray_results = r_results;
+	batch.hits = r_hits;
+	batch.query_count = p_ray_count;
+	batch.offsets.reserve(p_ray_count + 1);
+	batch.offsets.push_back(0);
+	for (int i = 0; i < p_ray_count; i++) {
+		int amount = space->broadphase->cull_segment(p_from[i], p_to[i], space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+		_add_batch_candidates(batch, amount);
+	}
+
+	_run_query_batch(batch, &GodotPhysicsDirectSpaceState3D::_intersect_rays_chunk);
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ERR_FAIL_COND(space->locked);
+	if (p_query_count <= 0) {
+		return;
+	}
+	if (p_result_max <= 0) {
+		memset(r_result_counts, 0, p_query_count * sizeof(int));
+		return;
+	}
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	QueryBatch batch;
+	batch.shape_parameters = &p_parameters;
+	batch.shape = shape;
+	batch.transforms = p_transforms;
+	batch.shape_results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+	batch.query_count = p_query_count;
+	batch.offsets.reserve(p_query_count + 1);
+	batch.offsets.push_back(0);
+	for (int i = 0; i < p_query_count; i++) {
+		AABB aabb = p_transforms[i].xform(shape->get_aabb());
+		int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+		_add_batch_candidates(batch, amount);
+	}
+
+	_run_query_batch(batch, &GodotPhysicsDirectSpaceState3D::_intersect_shapes_chunk);
+}
+
 bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
 	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_NULL_V(shape, false);
@@ -1097,6 +1204,87 @@ void GodotSpace3D::body_remove_from_active_list(SelfList<GodotBody3D> *p_body) {
 	active_list.remove(p_body);
 }
 
+void GodotSpace3D::body_add_to_suspended_list(SelfList<GodotBody3D> *p_body) {
+	suspended_list.add(p_body);
+}
+
+void GodotSpace3D::body_remove_from_suspended_list(SelfList<GodotBody3D> *p_body) {
+	suspended_list.remove(p_body);
+}
+
+void GodotSpace3D::set_active_regions(const Vector<AABB> &p_regions) {
+	// Regions are usually set every frame, only look for bodies to resume when they actually change.
+	if (active_regions.size() == (uint32_t)p_regions.size()) {
+		bool changed = false;
+		for (uint32_t i = 0; i < active_regions.size(); i++) {
+			if (active_regions[i] != p_regions[i]) {
+				changed = true;
+				break;
+			}
+		}
+		if (!changed) {
+			return;
+		}
+	}
+
+	active_regions.resize(p_regions.size());
+	for (uint32_t i = 0; i < active_regions.size(); i++) {
+		active_regions[i] = p_regions[i].abs();
+	}
+	active_regions_changed = true;
+}
+
+bool GodotSpace3D::is_in_active_region(const Vector3 &p_point) const {
+	for (const AABB &region : active_regions) {
+		if (region.has_point(p_point)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void GodotSpace3D::resume_bodies_in_active_regions() {
+	if (!active_regions_changed) {
+		return;
+	}
+	active_regions_changed = false;
+
+	if (active_regions.is_empty()) {
+		while (suspended_list.first()) {
+			suspended_list.first()->self()->set_active(true);
+		}
+		return;
+	}
+
+	// Suspended bodies don't move, so the broadphase finds the ones a region now covers without visiting the others.
+	for (const AABB &region : active_regions) {
+		if (suspended_list.first() == nullptr) {
+			break;
+		}
+
+		int count = 0;
+		active_region_query_results.resize(MAX(active_region_query_results.size(), (uint32_t)INTERSECTION_QUERY_MAX));
+		while (true) {
+			count = broadphase->cull_aabb(region, active_region_query_results.ptr(), active_region_query_results.size());
+			if (count < (int)active_region_query_results.size()) {
+				break;
+			}
+			active_region_query_results.resize(active_region_query_results.size() * 2);
+		}
+
+		for (int i = 0; i < count; i++) {
+			GodotCollisionObject3D *object = active_region_query_results[i];
+			if (object->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+				continue;
+			}
+			GodotBody3D *body = static_cast<GodotBody3D *>(object);
+			if (body->is_suspended() && region.has_point(body->get_transform().origin)) {
+				body->set_active(true);
+			}
+		}
+	}
+}
+
 void GodotSpace3D::body_add_to_mass_properties_update_list(SelfList<GodotBody3D> *p_body) {
 	mass_properties_update_list.add(p_body);
 }
@@ -1123,6 +1311,160 @@ const HashSet<GodotCollisionObject3D *> &GodotSpace3D::get_objects() const {
 	return objects;
 }
 
+struct _BodyOrder3D {
+	_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const {
+		return p_a->get_self() < p_b->get_self();
+	}
+};
+
+struct _ConstraintKeyOrder3D {
+	_FORCE_INLINE_ bool operator()(const Pair<GodotConstraint3D::OrderKey, GodotConstraint3D *> &p_a, const Pair<GodotConstraint3D::OrderKey, GodotConstraint3D *> &p_b) const {
+		return p_a.first < p_b.first;
+	}
+};
+
+void GodotSpace3D::_get_bodies_in_order(LocalVector<GodotBody3D *> &r_bodies) const {
+	r_bodies.clear();
+	for (GodotCollisionObject3D *object : objects) {
+		if (object->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			r_bodies.push_back(static_cast<GodotBody3D *>(object));
+		}
+	}
+	r_bodies.sort_custom<_BodyOrder3D>();
+}
+
+void GodotSpace3D::_get_stateful_constraints_in_order(const LocalVector<GodotBody3D *> &p_bodies, LocalVector<GodotConstraint3D *> &r_constraints) const {
+	LocalVector<Pair<GodotConstraint3D::OrderKey, GodotConstraint3D *>> keyed;
+	for (const GodotBody3D *body : p_bodies) {
+		for (const KeyValue<GodotConstraint3D *, int> &E : body->get_constraint_map()) {
+			// Every constraint is listed by its first body, so this visits each one once.
+			if (E.value == 0 && E.key->has_step_state()) {
+				keyed.push_back({ E.key->get_order_key(), E.key });
+			}
+		}
+	}
+	keyed.sort_custom<_ConstraintKeyOrder3D>();
+
+	r_constraints.resize(keyed.size());
+	for (uint32_t i = 0; i < keyed.size(); i++) {
+		r_constraints[i] = keyed[i].second;
+	}
+}
+
+Vector<uint8_t> GodotSpace3D::save_state() {
+	LocalVector<GodotBody3D *> bodies;
+	_get_bodies_in_order(bodies);
+	LocalVector<GodotConstraint3D *> constraints;
+	_get_stateful_constraints_in_order(bodies, constraints);
+
+	state_buffer.clear();
+	GodotStateWriter3D writer(state_buffer);
+	writer.write<uint32_t>(STATE_MAGIC);
+	writer.write<uint32_t>(STATE_VERSION);
+
+	// Each record is prefixed with its size, so records for objects that no longer exist can be skipped on restore.
+	writer.write<uint32_t>(bodies.size());
+	for (const GodotBody3D *body : bodies) {
+		writer.write(body->get_self().get_id());
+		const uint32_t size_position = writer.get_position();
+		writer.write<uint32_t>(0);
+		body->save_step_state(writer);
+		writer.write_at<uint32_t>(size_position, writer.get_position() - size_position - sizeof(uint32_t));
+	}
+
+	writer.write<uint32_t>(constraints.size());
+	for (const GodotConstraint3D *constraint : constraints) {
+		const GodotConstraint3D::OrderKey key = constraint->get_order_key();
+		writer.write(key.self);
+		writer.write(key.object_A);
+		writer.write(key.object_B);
+		writer.write(key.sub);
+		const uint32_t size_position = writer.get_position();
+		writer.write<uint32_t>(0);
+		constraint->save_step_state(writer);
+		writer.write_at<uint32_t>(size_position, writer.get_position() - size_position - sizeof(uint32_t));
+	}
+
+	Vector<uint8_t> state;
+	state.resize(state_buffer.size());
+	memcpy(state.ptrw(), state_buffer.ptr(), state_buffer.size());
+	return state;
+}
+
+Error GodotSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	GodotStateReader3D reader(p_state.ptr(), p_state.size());
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	reader.read(magic);
+	reader.read(version);
+	ERR_FAIL_COND_V_MSG(reader.has_failed() || magic != STATE_MAGIC || version != STATE_VERSION, ERR_INVALID_DATA, "Invalid physics space state.");
+
+	// Records are sorted like the bodies and constraints of the space, so both lists are walked in step.
+	LocalVector<GodotBody3D *> bodies;
+	_get_bodies_in_order(bodies);
+
+	uint32_t body_count = 0;
+	reader.read(body_count);
+	uint32_t body_index = 0;
+	for (uint32_t i = 0; i < body_count && !reader.has_failed(); i++) {
+		uint64_t id = 0;
+		uint32_t size = 0;
+		reader.read(id);
+		reader.read(size);
+		GodotStateReader3D record(reader.get_ptr(), size);
+		reader.skip(size);
+		if (reader.has_failed()) {
+			break;
+		}
+
+		while (body_index < bodies.size() && bodies[body_index]->get_self().get_id() < id) {
+			body_index++;
+		}
+		if (body_index < bodies.size() && bodies[body_index]->get_self().get_id() == id) {
+			bodies[body_index]->restore_step_state(record);
+		}
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_failed(), ERR_INVALID_DATA, "Invalid physics space state.");
+
+	// Pairs depend on where the bodies are, let the broadphase catch up before restoring contacts.
+	update();
+
+	LocalVector<GodotConstraint3D *> constraints;
+	_get_stateful_constraints_in_order(bodies, constraints);
+
+	uint32_t constraint_count = 0;
+	reader.read(constraint_count);
+	uint32_t constraint_index = 0;
+	for (uint32_t i = 0; i < constraint_count && !reader.has_failed(); i++) {
+		GodotConstraint3D::OrderKey key;
+		uint32_t size = 0;
+		reader.read(key.self);
+		reader.read(key.object_A);
+		reader.read(key.object_B);
+		reader.read(key.sub);
+		reader.read(size);
+		GodotStateReader3D record(reader.get_ptr(), size);
+		reader.skip(size);
+		if (reader.has_failed()) {
+			break;
+		}
+
+		// Constraints that didn't exist when the state was saved start over.
+		while (constraint_index < constraints.size() && constraints[constraint_index]->get_order_key() < key) {
+			constraints[constraint_index++]->clear_step_state();
+		}
+		if (constraint_index < constraints.size() && constraints[constraint_index]->get_order_key() == key) {
+			constraints[constraint_index++]->restore_step_state(record);
+		}
+	}
+	while (constraint_index < constraints.size()) {
+		constraints[constraint_index++]->clear_step_state();
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_failed() || !reader.is_at_end(), ERR_INVALID_DATA, "Invalid physics space state.");
+
+	return OK;
+}
+
 void GodotSpace3D::body_add_to_state_query_list(SelfList<GodotBody3D> *p_body) {
 	state_query_list.add(p_body);
 }
@@ -1164,17 +1506,67 @@ void GodotSpace3D::soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *
 }
 
 void GodotSpace3D::call_queries() {
+	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
+
 	while (state_query_list.first()) {
 		GodotBody3D *b = state_query_list.first()->self();
 		state_query_list.remove(state_query_list.first());
 		b->call_queries();
 	}
 
+	uint64_t profile_endtime = OS::get_singleton()->get_ticks_usec();
+	elapsed_time[ELAPSED_TIME_STATE_SYNC] = profile_endtime - profile_begtime;
+	profile_begtime = profile_endtime;
+
 	while (monitor_query_list.first()) {
 		GodotArea3D *a = monitor_query_list.first()->self();
 		monitor_query_list.remove(monitor_query_list.first());
 		a->call_queries();
 	}
+
+	elapsed_time[ELAPSED_TIME_AREA_CALLBACKS] = OS::get_singleton()->get_ticks_usec() - profile_begtime;
+}
+
+int GodotSpace3D::get_process_info(PhysicsServer3D::ProcessInfo p_info) const {
+	switch (p_info) {
+		case PhysicsServer3D::INFO_ACTIVE_OBJECTS: {
+			return active_objects;
+		} break;
+		case PhysicsServer3D::INFO_COLLISION_PAIRS: {
+			return collision_pairs;
+		} break;
+		case PhysicsServer3D::INFO_ISLAND_COUNT: {
+			return island_count;
+		} break;
+		case PhysicsServer3D::INFO_STEP_TIME: {
+			uint64_t step_time = 0;
+			for (int i = 0; i <= ELAPSED_TIME_INTEGRATE_VELOCITIES; i++) {
+				step_time += elapsed_time[i];
+			}
+			return step_time;
+		} break;
+		case PhysicsServer3D::INFO_BROAD_PHASE_TIME: {
+			return elapsed_time[ELAPSED_TIME_BROAD_PHASE];
+		} break;
+		case PhysicsServer3D::INFO_NARROW_PHASE_TIME: {
+			// Collisions are detected while setting up the constraints of each pair.
+			return elapsed_time[ELAPSED_TIME_SETUP_CONSTRAINTS];
+		} break;
+		case PhysicsServer3D::INFO_SOLVER_TIME: {
+			return elapsed_time[ELAPSED_TIME_GENERATE_ISLANDS] + elapsed_time[ELAPSED_TIME_SOLVE_CONSTRAINTS];
+		} break;
+		case PhysicsServer3D::INFO_INTEGRATION_TIME: {
+			return elapsed_time[ELAPSED_TIME_INTEGRATE_FORCES] + elapsed_time[ELAPSED_TIME_INTEGRATE_VELOCITIES];
+		} break;
+		case PhysicsServer3D::INFO_STATE_SYNC_TIME: {
+			return elapsed_time[ELAPSED_TIME_STATE_SYNC];
+		} break;
+		case PhysicsServer3D::INFO_AREA_CALLBACK_TIME: {
+			return elapsed_time[ELAPSED_TIME_AREA_CALLBACKS];
+		} break;
+	}
+
+	return 0;
 }
 
 void GodotSpace3D::setup() {
@@ -41,12 +41,46 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	// Number of queries handled by each worker thread task in batched queries.
+	static constexpr int QUERY_BATCH_CHUNK_SIZE = 64;
+
+	// Broad phase results of a batch, query i uses the candidates in [offsets[i], offsets[i + 1]).
+	struct QueryBatch {
+		const RayParameters *ray_parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *ray_results = nullptr;
+		bool *hits = nullptr;
+
+		const ShapeParameters *shape_parameters = nullptr;
+		const GodotShape3D *shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		ShapeResult *shape_results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+
+		int query_count = 0;
+		LocalVector<GodotCollisionObject3D *> objects;
+		LocalVector<int> subindices;
+		LocalVector<uint32_t> offsets;
+	};
+
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) const;
+	int _intersect_shape(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, const Transform3D &p_transform, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, ShapeResult *r_results, int p_result_max) const;
+
+	void _add_batch_candidates(QueryBatch &r_batch, int p_amount) const;
+	void _run_query_batch(QueryBatch &p_batch, void (GodotPhysicsDirectSpaceState3D::*p_method)(uint32_t, QueryBatch *));
+	void _intersect_rays_chunk(uint32_t p_chunk, QueryBatch *p_batch);
+	void _intersect_shapes_chunk(uint32_t p_chunk, QueryBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
@@ -59,10 +93,13 @@ class GodotSpace3D {
 public:
 	enum ElapsedTime {
 		ELAPSED_TIME_INTEGRATE_FORCES,
+		ELAPSED_TIME_BROAD_PHASE,
 		ELAPSED_TIME_GENERATE_ISLANDS,
 		ELAPSED_TIME_SETUP_CONSTRAINTS,
 		ELAPSED_TIME_SOLVE_CONSTRAINTS,
 		ELAPSED_TIME_INTEGRATE_VELOCITIES,
+		ELAPSED_TIME_STATE_SYNC,
+		ELAPSED_TIME_AREA_CALLBACKS,
 		ELAPSED_TIME_MAX
 
 	};
@@ -80,6 +117,7 @@ private:
 	SelfList<GodotArea3D>::List monitor_query_list;
 	SelfList<GodotArea3D>::List area_moved_list;
 	SelfList<GodotSoftBody3D>::List active_soft_body_list;
+	SelfList<GodotBody3D>::List suspended_list;
 
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
@@ -119,6 +157,16 @@ private:
 	Vector<Vector3> contact_debug;
 	int contact_debug_count = 0;
 
+	LocalVector<AABB> active_regions;
+	bool active_regions_changed = false;
+	LocalVector<GodotCollisionObject3D *> active_region_query_results;
+
+	// Reused between calls to save_state(), to avoid reallocating every frame.
+	LocalVector<uint8_t> state_buffer;
+
+	void _get_bodies_in_order(LocalVector<GodotBody3D *> &r_bodies) const;
+	void _get_stateful_constraints_in_order(const LocalVector<GodotBody3D *> &p_bodies, LocalVector<GodotConstraint3D *> &r_constraints) const;
+
 	friend class GodotPhysicsDirectSpaceState3D;
 
 	int _cull_aabb_for_body(GodotBody3D *p_body, const AABB &p_aabb);
@@ -136,6 +184,9 @@ public:
 	void body_add_to_mass_properties_update_list(SelfList<GodotBody3D> *p_body);
 	void body_remove_from_mass_properties_update_list(SelfList<GodotBody3D> *p_body);
 
+	void body_add_to_suspended_list(SelfList<GodotBody3D> *p_body);
+	void body_remove_from_suspended_list(SelfList<GodotBody3D> *p_body);
+
 	void body_add_to_state_query_list(SelfList<GodotBody3D> *p_body);
 	void body_remove_from_state_query_list(SelfList<GodotBody3D> *p_body);
 
@@ -178,6 +229,15 @@ public:
 	void set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer3D::SpaceParameter p_param) const;
 
+	// When active regions are set, islands with no body inside any of them are suspended at the end of each step.
+	void set_active_regions(const Vector<AABB> &p_regions);
+	_FORCE_INLINE_ bool has_active_regions() const { return !active_regions.is_empty(); }
+	bool is_in_active_region(const Vector3 &p_point) const;
+	void resume_bodies_in_active_regions();
+
+	Vector<uint8_t> save_state();
+	Error restore_state(const Vector<uint8_t> &p_state);
+
 	void set_island_count(int p_island_count) { island_count = p_island_count; }
 	int get_island_count() const { return island_count; }
 
@@ -204,6 +264,8 @@ public:
 	void set_elapsed_time(ElapsedTime p_time, uint64_t p_msec) { elapsed_time[p_time] = p_msec; }
 	uint64_t get_elapsed_time(ElapsedTime p_time) const { return elapsed_time[p_time]; }
 
+	int get_process_info(PhysicsServer3D::ProcessInfo p_info) const;
+
 	bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result);
 
 	GodotSpace3D();
@@ -30,6 +30,7 @@
 
 #include "godot_step_3d.h"
 
+#include "godot_body_pair_3d.h"
 #include "godot_joint_3d.h"
 
 #include "core/object/worker_thread_pool.h"
@@ -158,6 +159,27 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_solve_ccd_body(uint32_t p_body_index, void *p_userdata) {
+	GodotBody3D *body = ccd_bodies[p_body_index];
+
+	// Stop at the first body it would hit.
+	real_t fraction = 1.0;
+	for (const KeyValue<GodotConstraint3D *, int> &E : body->get_constraint_map()) {
+		if (E.key->is_body_pair()) {
+			fraction = MIN(fraction, static_cast<const GodotBodyPair3D *>(E.key)->get_ccd_motion_fraction(body, delta));
+		}
+	}
+	body->set_ccd_motion_fraction(fraction);
+}
+
+void GodotStep3D::_predict_soft_body_motion(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->predict_motion(delta);
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -182,6 +204,27 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_check_active_regions(const LocalVector<GodotBody3D *> &p_body_island, const GodotSpace3D *p_space) const {
+	if (p_body_island.is_empty() || !p_body_island[0]->is_active()) {
+		return; // Already sleeping, islands sleep or wake up as a whole.
+	}
+
+	for (const GodotBody3D *body : p_body_island) {
+		if (p_space->is_in_active_region(body->get_transform().origin)) {
+			return;
+		}
+		for (const KeyValue<GodotConstraint3D *, int> &E : body->get_constraint_map()) {
+			if (E.key->get_soft_body_count() > 0) {
+				return; // Soft bodies can't be suspended, keep what they touch moving with them.
+			}
+		}
+	}
+
+	for (GodotBody3D *body : p_body_island) {
+		body->suspend();
+	}
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -189,6 +232,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	p_space->set_last_step(p_delta);
 
+	p_space->resume_bodies_in_active_regions();
+
 	iterations = p_space->get_solver_iterations();
 	delta = p_delta;
 
@@ -212,21 +257,38 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY MOTION */
 
+	soft_bodies.clear();
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->predict_motion(p_delta);
+		soft_bodies.push_back(sb->self());
 		sb = sb->next();
 		active_count++;
 	}
 
+	if (!soft_bodies.is_empty()) {
+		WorkerThreadPool::GroupID soft_body_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_predict_soft_body_motion, nullptr, soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodyPredictMotion"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(soft_body_task);
+
+		// WARNING: This doesn't run on threads, because it updates the broadphase.
+		for (GodotSoftBody3D *soft_body : soft_bodies) {
+			soft_body->update_collision_shape();
+		}
+	}
+
 	p_space->set_active_objects(active_count);
 
+	{ //profile
+		profile_endtime = OS::get_singleton()->get_ticks_usec();
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES, profile_endtime - profile_begtime);
+		profile_begtime = profile_endtime;
+	}
+
 	// Update the broadphase to register collision pairs.
 	p_space->update();
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
-		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_FORCES, profile_endtime - profile_begtime);
+		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_BROAD_PHASE, profile_endtime - profile_begtime);
 		profile_begtime = profile_endtime;
 	}
 
@@ -373,6 +435,24 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 		profile_begtime = profile_endtime;
 	}
 
+	/* CONTINUOUS COLLISION DETECTION */
+
+	// Velocities are final at this point, so the motion of each body is known.
+	ccd_bodies.clear();
+	b = body_list->first();
+	while (b) {
+		GodotBody3D *body = b->self();
+		if (body->is_continuous_collision_detection_enabled() && body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
+			ccd_bodies.push_back(body);
+		}
+		b = b->next();
+	}
+
+	if (!ccd_bodies.is_empty()) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_ccd_body, nullptr, ccd_bodies.size(), -1, true, SNAME("Physics3DContinuousCollisionDetection"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	/* INTEGRATE VELOCITIES */
 
 	b = body_list->first();
@@ -388,12 +468,30 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 		_check_suspend(body_islands[island_index]);
 	}
 
+	if (p_space->has_active_regions()) {
+		for (uint32_t island_index = 0; island_index < body_island_count; ++island_index) {
+			_check_active_regions(body_islands[island_index], p_space);
+		}
+	}
+
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
+	if (!soft_bodies.is_empty()) {
+		// With fewer soft bodies than threads, large soft bodies get all threads to solve their links one after the other,
+		// and the remaining soft bodies are solved in parallel with each other.
+		const bool parallel_links = soft_bodies.size() < (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count();
+		uint32_t soft_body_count = 0;
+		for (uint32_t i = 0; i < soft_bodies.size(); ++i) {
+			if (parallel_links && soft_bodies[i]->can_solve_links_in_parallel()) {
+				soft_bodies[i]->solve_constraints(p_delta, true);
+			} else {
+				soft_bodies[soft_body_count++] = soft_bodies[i];
+			}
+		}
+		soft_bodies.resize(soft_body_count);
+
+		WorkerThreadPool::GroupID soft_body_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, soft_body_count, -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(soft_body_task);
 	}
 
 	{ //profile
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  test_godot_soft_body_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_soft_body_3d.h"
+
+#include "core/math/random_pcg.h"
+
+#include "tests/servers/test_physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotSoftBody3D {
+
+TEST_CASE("[SceneTree][GodotSoftBody3D] Links solved on multiple threads match the single-threaded result") {
+	constexpr int CLOTH_SIZE = 128;
+	constexpr int STEP_COUNT = 10;
+	constexpr real_t DELTA = 1.0 / 60.0;
+
+	RID mesh = TestPhysicsServer3D::create_cloth_mesh(CLOTH_SIZE);
+	GodotSoftBody3D *bodies[2] = { memnew(GodotSoftBody3D), memnew(GodotSoftBody3D) };
+	for (GodotSoftBody3D *body : bodies) {
+		body->set_mesh(mesh);
+	}
+	REQUIRE(bodies[1]->can_solve_links_in_parallel());
+	const uint32_t node_count = bodies[0]->get_node_count();
+	REQUIRE_EQ(node_count, bodies[1]->get_node_count());
+
+	// Same random push on both cloths, so the links have something to solve.
+	LocalVector<Vector3> initial_positions;
+	RandomPCG rng(7);
+	for (uint32_t i = 0; i < node_count; i++) {
+		initial_positions.push_back(bodies[0]->get_node_position(i));
+		const Vector3 impulse(rng.random(-1.0f, 1.0f), rng.random(-1.0f, 1.0f), rng.random(-1.0f, 1.0f));
+		bodies[0]->apply_node_impulse(i, impulse);
+		bodies[1]->apply_node_impulse(i, impulse);
+	}
+
+	for (int step = 0; step < STEP_COUNT; step++) {
+		bodies[0]->solve_constraints(DELTA, false);
+		bodies[1]->solve_constraints(DELTA, true);
+	}
+
+	uint32_t moved_count = 0;
+	uint32_t mismatch_count = 0;
+	for (uint32_t i = 0; i < node_count; i++) {
+		const Vector3 position = bodies[0]->get_node_position(i);
+		if (position != initial_positions[i]) {
+			moved_count++;
+		}
+		if (position != bodies[1]->get_node_position(i)) {
+			mismatch_count++;
+		}
+	}
+	CHECK(moved_count > 0);
+	CHECK_MESSAGE(mismatch_count == 0, vformat("%d of %d cloth points differ between the single and multi-threaded link solvers.", mismatch_count, node_count));
+
+	for (GodotSoftBody3D *body : bodies) {
+		memdelete(body);
+	}
+	RS::get_singleton()->free(mesh);
+}
+
+} // namespace TestGodotSoftBody3D
@@ -53,6 +53,8 @@
 #include "spaces/jolt_physics_direct_space_state_3d.h"
 #include "spaces/jolt_space_3d.h"
 
+#include "core/debugger/engine_debugger.h"
+
 JoltPhysicsServer3D::JoltPhysicsServer3D(bool p_on_separate_thread) :
 		on_separate_thread(p_on_separate_thread) {
 	singleton = this;
@@ -267,6 +269,22 @@ int JoltPhysicsServer3D::space_get_contact_count(RID p_space) const {
 #endif
 }
 
+Vector<uint8_t> JoltPhysicsServer3D::space_save_state(RID p_space) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG((on_separate_thread && !doing_sync) || space->is_stepping(), Vector<uint8_t>(), "Space state is inaccessible right now, wait for iteration or physics process notification.");
+
+	return space->save_state();
+}
+
+Error JoltPhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG((on_separate_thread && !doing_sync) || space->is_stepping(), ERR_LOCKED, "Space state is inaccessible right now, wait for iteration or physics process notification.");
+
+	return space->restore_state(p_state);
+}
+
 RID JoltPhysicsServer3D::area_create() {
 	JoltArea3D *area = memnew(JoltArea3D);
 	RID rid = area_owner.make_rid(area);
@@ -1576,12 +1594,31 @@ void JoltPhysicsServer3D::step(real_t p_step) {
 		return;
 	}
 
+	step_time = 0;
+	broad_phase_time = 0;
+	narrow_phase_time = 0;
+	solver_time = 0;
+	integration_time = 0;
+
 	for (JoltSpace3D *active_space : active_spaces) {
 		job_system->pre_step();
 
 		active_space->step((float)p_step);
 
 		job_system->post_step();
+
+#ifdef DEBUG_ENABLED
+		for (int i = 0; i < JoltJobSystem::JOB_PHASE_MAX; i++) {
+			const JoltJobSystem::JobPhase phase = JoltJobSystem::JobPhase(i);
+			active_space->set_job_timing(phase, job_system->get_step_timing(phase));
+		}
+#endif
+
+		step_time += active_space->get_process_info(INFO_STEP_TIME);
+		broad_phase_time += active_space->get_process_info(INFO_BROAD_PHASE_TIME);
+		narrow_phase_time += active_space->get_process_info(INFO_NARROW_PHASE_TIME);
+		solver_time += active_space->get_process_info(INFO_SOLVER_TIME);
+		integration_time += active_space->get_process_info(INFO_INTEGRATION_TIME);
 	}
 }
 
@@ -1600,13 +1637,44 @@ void JoltPhysicsServer3D::flush_queries() {
 
 	flushing_queries = true;
 
+	state_sync_time = 0;
+	area_callback_time = 0;
+
 	for (JoltSpace3D *space : active_spaces) {
 		space->call_queries();
+
+		state_sync_time += space->get_process_info(INFO_STATE_SYNC_TIME);
+		area_callback_time += space->get_process_info(INFO_AREA_CALLBACK_TIME);
 	}
 
 	flushing_queries = false;
 
 #ifdef DEBUG_ENABLED
+	static const StringName profiler_name("servers");
+
+	EngineDebugger *engine_debugger = EngineDebugger::get_singleton();
+
+	if (engine_debugger->is_profiling(profiler_name)) {
+		Array timings;
+		timings.push_back("physics_3d");
+		timings.push_back("step");
+		timings.push_back(USEC_TO_SEC(step_time));
+		timings.push_back("broad_phase");
+		timings.push_back(USEC_TO_SEC(broad_phase_time));
+		timings.push_back("narrow_phase");
+		timings.push_back(USEC_TO_SEC(narrow_phase_time));
+		timings.push_back("solver");
+		timings.push_back(USEC_TO_SEC(solver_time));
+		timings.push_back("integration");
+		timings.push_back(USEC_TO_SEC(integration_time));
+		timings.push_back("state_sync");
+		timings.push_back(USEC_TO_SEC(state_sync_time));
+		timings.push_back("area_callbacks");
+		timings.push_back(USEC_TO_SEC(area_callback_time));
+
+		engine_debugger->profiler_add_frame_data(profiler_name, timings);
+	}
+
 	job_system->flush_timings();
 #endif
 }
@@ -1616,7 +1684,39 @@ bool JoltPhysicsServer3D::is_flushing_queries() const {
 }
 
 int JoltPhysicsServer3D::get_process_info(ProcessInfo p_process_info) {
-	return 0;
+	switch (p_process_info) {
+		case INFO_STEP_TIME: {
+			return step_time;
+		}
+		case INFO_BROAD_PHASE_TIME: {
+			return broad_phase_time;
+		}
+		case INFO_NARROW_PHASE_TIME: {
+			return narrow_phase_time;
+		}
+		case INFO_SOLVER_TIME: {
+			return solver_time;
+		}
+		case INFO_INTEGRATION_TIME: {
+			return integration_time;
+		}
+		case INFO_STATE_SYNC_TIME: {
+			return state_sync_time;
+		}
+		case INFO_AREA_CALLBACK_TIME: {
+			return area_callback_time;
+		}
+		default: {
+			return 0;
+		}
+	}
+}
+
+int JoltPhysicsServer3D::space_get_process_info(RID p_space, ProcessInfo p_process_info) {
+	const JoltSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, 0);
+
+	return space->get_process_info(p_process_info);
 }
 
 void JoltPhysicsServer3D::free_space(JoltSpace3D *p_space) {
@@ -57,6 +57,15 @@ class JoltPhysicsServer3D final : public PhysicsServer3D {
 
 	JoltJobSystem *job_system = nullptr;
 
+	// Summed over all active spaces, in microseconds.
+	int step_time = 0;
+	int broad_phase_time = 0;
+	int narrow_phase_time = 0;
+	int solver_time = 0;
+	int integration_time = 0;
+	int state_sync_time = 0;
+	int area_callback_time = 0;
+
 	bool on_separate_thread = false;
 	bool active = true;
 	bool flushing_queries = false;
@@ -162,6 +171,9 @@ public:
 	virtual PackedVector3Array space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) override;
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override;
+
 	virtual RID area_create() override;
 
 	virtual void area_set_space(RID p_area, RID p_space) override;
@@ -419,6 +431,7 @@ public:
 	virtual bool is_flushing_queries() const override;
 
 	virtual int get_process_info(PhysicsServer3D::ProcessInfo p_process_info) override;
+	virtual int space_get_process_info(RID p_space, PhysicsServer3D::ProcessInfo p_process_info) override;
 
 	bool is_on_separate_thread() const { return on_separate_thread; }
 	bool is_active() const { return active; }
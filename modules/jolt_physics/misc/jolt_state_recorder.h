@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  jolt_state_recorder.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/local_vector.h"
+
+#include "Jolt/Jolt.h"
+
+#include "Jolt/Physics/StateRecorder.h"
+
+// Keeps states in memory rather than in the `std::stringstream` used by `JPH::StateRecorderImpl`,
+// so that saving and restoring states many times per frame doesn't allocate.
+class JoltStateRecorder final : public JPH::StateRecorder {
+	LocalVector<uint8_t> *buffer = nullptr;
+	const uint8_t *read_ptr = nullptr;
+	const uint8_t *read_end = nullptr;
+	bool failed = false;
+
+public:
+	// Appends to the end of the buffer.
+	explicit JoltStateRecorder(LocalVector<uint8_t> &p_buffer) :
+			buffer(&p_buffer) {}
+
+	JoltStateRecorder(const uint8_t *p_data, uint32_t p_size) :
+			read_ptr(p_data), read_end(p_data + p_size) {}
+
+	virtual void WriteBytes(const void *p_data, size_t p_bytes) override {
+		if (unlikely(buffer == nullptr)) {
+			failed = true;
+			return;
+		}
+		const uint32_t offset = buffer->size();
+		buffer->resize(offset + p_bytes);
+		memcpy(buffer->ptr() + offset, p_data, p_bytes);
+	}
+
+	// Reading past the end sets the failed flag and leaves the data untouched.
+	virtual void ReadBytes(void *p_data, size_t p_bytes) override {
+		if (unlikely(failed || (size_t)(read_end - read_ptr) < p_bytes)) {
+			failed = true;
+			return;
+		}
+		memcpy(p_data, read_ptr, p_bytes);
+		read_ptr += p_bytes;
+	}
+
+	virtual bool IsEOF() const override { return read_ptr == read_end; }
+	virtual bool IsFailed() const override { return failed; }
+};
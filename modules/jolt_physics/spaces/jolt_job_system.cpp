@@ -39,6 +39,8 @@
 
 #include "Jolt/Physics/PhysicsSettings.h"
 
+#include <cstring>
+
 void JoltJobSystem::Job::_execute(void *p_user_data) {
 	Job *job = static_cast<Job *>(p_user_data);
 
@@ -159,6 +161,43 @@ void JoltJobSystem::_reclaim_jobs() {
 	}
 }
 
+#ifdef DEBUG_ENABLED
+
+JoltJobSystem::JobPhase JoltJobSystem::_get_job_phase(const char *p_name) {
+	static const char *broad_phase_jobs[] = { "UpdateBroadPhasePrepare", "UpdateBroadPhaseFinalize" };
+	static const char *narrow_phase_jobs[] = { "FindCollisions", "FindCCDContacts", "ResolveCCDContacts", "ContactRemovedCallbacks", "SoftBodyCollide" };
+	static const char *solver_jobs[] = { "DetermineActiveConstraints", "BuildIslandsFromConstraints", "FinalizeIslands", "BodySetIslandIndex", "SetupVelocityConstraints", "SolveVelocityConstraints", "SolvePositionConstraints", "SoftBodySimulate" };
+	static const char *integration_jobs[] = { "ApplyGravity", "PreIntegrateVelocity", "IntegrateVelocity", "PostIntegrateVelocity", "SoftBodyPrepare", "SoftBodyFinalize" };
+
+	for (const char *name : broad_phase_jobs) {
+		if (strcmp(p_name, name) == 0) {
+			return JOB_PHASE_BROAD_PHASE;
+		}
+	}
+
+	for (const char *name : narrow_phase_jobs) {
+		if (strcmp(p_name, name) == 0) {
+			return JOB_PHASE_NARROW_PHASE;
+		}
+	}
+
+	for (const char *name : solver_jobs) {
+		if (strcmp(p_name, name) == 0) {
+			return JOB_PHASE_SOLVER;
+		}
+	}
+
+	for (const char *name : integration_jobs) {
+		if (strcmp(p_name, name) == 0) {
+			return JOB_PHASE_INTEGRATION;
+		}
+	}
+
+	return JOB_PHASE_NONE;
+}
+
+#endif
+
 JoltJobSystem::JoltJobSystem() :
 		JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers),
 		thread_count(MAX(1, WorkerThreadPool::get_singleton()->get_thread_count())) {
@@ -166,11 +205,44 @@ JoltJobSystem::JoltJobSystem() :
 }
 
 void JoltJobSystem::pre_step() {
-	// Nothing to do.
+#ifdef DEBUG_ENABLED
+	timings_lock.lock();
+
+	for (const KeyValue<const void *, uint64_t> &E : timings_by_job) {
+		step_start_timings[E.key] = E.value;
+	}
+
+	timings_lock.unlock();
+#endif
 }
 
 void JoltJobSystem::post_step() {
 	_reclaim_jobs();
+
+#ifdef DEBUG_ENABLED
+	for (uint64_t &timing : step_timings) {
+		timing = 0;
+	}
+
+	timings_lock.lock();
+
+	for (const KeyValue<const void *, uint64_t> &E : timings_by_job) {
+		JobPhase *phase = phases_by_job.getptr(E.key);
+
+		if (phase == nullptr) {
+			phase = &phases_by_job.insert(E.key, _get_job_phase(static_cast<const char *>(E.key)))->value;
+		}
+
+		if (*phase == JOB_PHASE_NONE) {
+			continue;
+		}
+
+		const uint64_t *start_timing = step_start_timings.getptr(E.key);
+		step_timings[*phase] += E.value - (start_timing != nullptr ? *start_timing : 0);
+	}
+
+	timings_lock.unlock();
+#endif
 }
 
 #ifdef DEBUG_ENABLED
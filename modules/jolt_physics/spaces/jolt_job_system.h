@@ -41,6 +41,17 @@
 #include <atomic>
 
 class JoltJobSystem final : public JPH::JobSystemWithBarrier {
+public:
+	enum JobPhase {
+		JOB_PHASE_BROAD_PHASE,
+		JOB_PHASE_NARROW_PHASE,
+		JOB_PHASE_SOLVER,
+		JOB_PHASE_INTEGRATION,
+		JOB_PHASE_MAX,
+		JOB_PHASE_NONE = JOB_PHASE_MAX,
+	};
+
+private:
 	class Job : public JPH::JobSystem::Job {
 		inline static std::atomic<Job *> completed_head = nullptr;
 
@@ -76,6 +87,10 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 
 	// TODO: Check whether the usage of SpinLock is justified or if this should be a mutex instead.
 	inline static SpinLock timings_lock;
+
+	HashMap<const void *, JobPhase> phases_by_job;
+	HashMap<const void *, uint64_t> step_start_timings;
+	uint64_t step_timings[JOB_PHASE_MAX] = {};
 #endif
 
 	JPH::FixedSizeFreeList<Job> jobs;
@@ -91,6 +106,10 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 
 	void _reclaim_jobs();
 
+#ifdef DEBUG_ENABLED
+	static JobPhase _get_job_phase(const char *p_name);
+#endif
+
 public:
 	JoltJobSystem();
 
@@ -98,6 +117,9 @@ public:
 	void post_step();
 
 #ifdef DEBUG_ENABLED
+	// Time spent in jobs of the given phase during the last step, summed over all threads.
+	uint64_t get_step_timing(JobPhase p_phase) const { return step_timings[p_phase]; }
+
 	void flush_timings();
 #endif
 };
@@ -44,6 +44,8 @@
 #include "jolt_query_filter_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "Jolt/Geometry/GJKClosestPoint.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyFilter.h"
@@ -465,15 +467,9 @@ JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_spac
 		space(p_space) {
 }
 
-bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
-
-	space->try_optimize();
-
-	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
-
-	const JPH::RVec3 from = to_jolt_r(p_parameters.from);
-	const JPH::RVec3 to = to_jolt_r(p_parameters.to);
+bool JoltPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const JoltQueryFilter3D &p_query_filter, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result) {
+	const JPH::RVec3 from = to_jolt_r(p_from);
+	const JPH::RVec3 to = to_jolt_r(p_to);
 	const JPH::Vec3 vector = JPH::Vec3(to - from);
 	const JPH::RRayCast ray(from, vector);
 
@@ -484,7 +480,7 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	settings.mBackFaceModeTriangles = back_face_mode;
 
 	JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
-	space->get_narrow_phase_query().CastRay(ray, settings, collector, query_filter, query_filter, query_filter);
+	space->get_narrow_phase_query().CastRay(ray, settings, collector, p_query_filter, p_query_filter, p_query_filter);
 
 	if (!collector.had_hit()) {
 		return false;
@@ -529,6 +525,66 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	return true;
 }
 
+void JoltPhysicsDirectSpaceState3D::_intersect_rays_chunk(uint32_t p_chunk, QueryBatch *p_batch) {
+	const int begin = p_chunk * QUERY_BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + QUERY_BATCH_CHUNK_SIZE, p_batch->query_count);
+	for (int i = begin; i < end; i++) {
+		p_batch->hits[i] = _intersect_ray(*p_batch->ray_parameters, *p_batch->query_filter, p_batch->from[i], p_batch->to[i], p_batch->ray_results[i]);
+	}
+}
+
+void JoltPhysicsDirectSpaceState3D::_intersect_shapes_chunk(uint32_t p_chunk, QueryBatch *p_batch) {
+	const int begin = p_chunk * QUERY_BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + QUERY_BATCH_CHUNK_SIZE, p_batch->query_count);
+	for (int i = begin; i < end; i++) {
+		p_batch->result_counts[i] = _intersect_shape(*p_batch->jolt_shape, *p_batch->shape_parameters, p_batch->transforms[i], *p_batch->query_filter, p_batch->shape_results + i * p_batch->result_max, p_batch->result_max);
+	}
+}
+
+void JoltPhysicsDirectSpaceState3D::_run_query_batch(QueryBatch &p_batch, void (JoltPhysicsDirectSpaceState3D::*p_method)(uint32_t, QueryBatch *)) {
+	const int chunk_count = (p_batch.query_count + QUERY_BATCH_CHUNK_SIZE - 1) / QUERY_BATCH_CHUNK_SIZE;
+	if (chunk_count == 1) {
+		(this->*p_method)(0, &p_batch);
+		return;
+	}
+
+	// Jolt queries only read the physics system, so they can run concurrently as long as the space isn't stepping.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, &p_batch, chunk_count, -1, true, SNAME("JoltPhysics3DQueryBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
+
+	space->try_optimize();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+
+	return _intersect_ray(p_parameters, query_filter, p_parameters.from, p_parameters.to, r_result);
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) {
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_rays must not be called while the physics space is being stepped.");
+
+	if (p_ray_count <= 0) {
+		return;
+	}
+
+	space->try_optimize();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+
+	QueryBatch batch;
+	batch.query_filter = &query_filter;
+	batch.ray_parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.ray_results = r_results;
+	batch.hits = r_hits;
+	batch.query_count = p_ray_count;
+	_run_query_batch(batch, &JoltPhysicsDirectSpaceState3D::_intersect_rays_chunk);
+}
+
 int JoltPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_point must not be called while the physics space is being stepped.");
 
@@ -584,22 +640,60 @@ int JoltPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_para
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
 	ERR_FAIL_NULL_V(jolt_shape, 0);
 
-	Transform3D transform = p_parameters.transform;
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
+
+	return _intersect_shape(*jolt_shape, p_parameters, p_parameters.transform, query_filter, r_results, p_result_max);
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_shapes must not be called while the physics space is being stepped.");
+
+	if (p_query_count <= 0) {
+		return;
+	}
+	if (p_result_max <= 0) {
+		memset(r_result_counts, 0, p_query_count * sizeof(int));
+		return;
+	}
+
+	space->try_optimize();
+
+	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	const JPH::ShapeRefC jolt_shape = shape->try_build();
+	ERR_FAIL_NULL(jolt_shape);
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
+
+	QueryBatch batch;
+	batch.query_filter = &query_filter;
+	batch.shape_parameters = &p_parameters;
+	batch.jolt_shape = jolt_shape.GetPtr();
+	batch.transforms = p_transforms;
+	batch.shape_results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+	batch.query_count = p_query_count;
+	_run_query_batch(batch, &JoltPhysicsDirectSpaceState3D::_intersect_shapes_chunk);
+}
+
+int JoltPhysicsDirectSpaceState3D::_intersect_shape(const JPH::Shape &p_jolt_shape, const ShapeParameters &p_parameters, const Transform3D &p_transform, const JoltQueryFilter3D &p_query_filter, ShapeResult *r_results, int p_result_max) const {
+	Transform3D transform = p_transform;
 	JOLT_ENSURE_SCALE_NOT_ZERO(transform, "intersect_shape was passed an invalid transform.");
 
 	Vector3 scale;
 	JoltMath::decompose(transform, scale);
-	JOLT_ENSURE_SCALE_VALID(jolt_shape, scale, "intersect_shape was passed an invalid transform.");
+	JOLT_ENSURE_SCALE_VALID(&p_jolt_shape, scale, "intersect_shape was passed an invalid transform.");
 
-	const Vector3 com_scaled = to_godot(jolt_shape->GetCenterOfMass());
+	const Vector3 com_scaled = to_godot(p_jolt_shape.GetCenterOfMass());
 	const Transform3D transform_com = transform.translated_local(com_scaled);
 
 	JPH::CollideShapeSettings settings;
 	settings.mMaxSeparationDistance = (float)p_parameters.margin;
 
-	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
 	JoltQueryCollectorAnyMulti<JPH::CollideShapeCollector, 32> collector(p_result_max);
-	_collide_shape_queries(jolt_shape, to_jolt(scale), to_jolt_r(transform_com), settings, to_jolt_r(transform_com.origin), collector, query_filter, query_filter, query_filter);
+	_collide_shape_queries(&p_jolt_shape, to_jolt(scale), to_jolt_r(transform_com), settings, to_jolt_r(transform_com.origin), collector, p_query_filter, p_query_filter, p_query_filter);
 
 	const int hit_count = collector.get_hit_count();
 
@@ -43,16 +43,45 @@
 #include "Jolt/Physics/Collision/ShapeFilter.h"
 
 class JoltBody3D;
+class JoltQueryFilter3D;
 class JoltShape3D;
 class JoltSpace3D;
 
 class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3D {
 	GDCLASS(JoltPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D)
 
+	// Number of queries handled by each worker thread task in batched queries.
+	static constexpr int QUERY_BATCH_CHUNK_SIZE = 64;
+
+	struct QueryBatch {
+		const JoltQueryFilter3D *query_filter = nullptr;
+		int query_count = 0;
+
+		const RayParameters *ray_parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *ray_results = nullptr;
+		bool *hits = nullptr;
+
+		const ShapeParameters *shape_parameters = nullptr;
+		const JPH::Shape *jolt_shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		ShapeResult *shape_results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+	};
+
 	JoltSpace3D *space = nullptr;
 
 	static void _bind_methods() {}
 
+	bool _intersect_ray(const RayParameters &p_parameters, const JoltQueryFilter3D &p_query_filter, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result);
+	int _intersect_shape(const JPH::Shape &p_jolt_shape, const ShapeParameters &p_parameters, const Transform3D &p_transform, const JoltQueryFilter3D &p_query_filter, ShapeResult *r_results, int p_result_max) const;
+
+	void _run_query_batch(QueryBatch &p_batch, void (JoltPhysicsDirectSpaceState3D::*p_method)(uint32_t, QueryBatch *));
+	void _intersect_rays_chunk(uint32_t p_chunk, QueryBatch *p_batch);
+	void _intersect_shapes_chunk(uint32_t p_chunk, QueryBatch *p_batch);
+
 	bool _cast_motion_impl(const JPH::Shape &p_jolt_shape, const Transform3D &p_transform_com, const Vector3 &p_scale, const Vector3 &p_motion, bool p_use_edge_removal, bool p_ignore_overlaps, const JPH::CollideShapeSettings &p_settings, const JPH::BroadPhaseLayerFilter &p_broad_phase_layer_filter, const JPH::ObjectLayerFilter &p_object_layer_filter, const JPH::BodyFilter &p_body_filter, const JPH::ShapeFilter &p_shape_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const;
 
 	bool _body_motion_recover(const JoltBody3D &p_body, const Transform3D &p_transform, float p_margin, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, Vector3 &r_recovery) const;
@@ -71,8 +100,10 @@ public:
 	explicit JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_space);
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &r_closest_safe, real_t &r_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
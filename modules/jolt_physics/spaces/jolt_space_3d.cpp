@@ -33,6 +33,7 @@
 #include "../joints/jolt_joint_3d.h"
 #include "../jolt_physics_server_3d.h"
 #include "../jolt_project_settings.h"
+#include "../misc/jolt_state_recorder.h"
 #include "../misc/jolt_stream_wrappers.h"
 #include "../objects/jolt_area_3d.h"
 #include "../objects/jolt_body_3d.h"
@@ -60,6 +61,9 @@ constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
 
+constexpr uint32_t STATE_MAGIC = 0x53334a47; // "GJ3S"
+constexpr uint32_t STATE_VERSION = 1;
+
 } // namespace
 
 void JoltSpace3D::_pre_step(float p_step) {
@@ -161,10 +165,18 @@ void JoltSpace3D::step(float p_step) {
 	stepping = true;
 	last_step = p_step;
 
+	const uint64_t time_begin = Time::get_singleton()->get_ticks_usec();
+
 	_pre_step(p_step);
 
+	const uint64_t time_update = Time::get_singleton()->get_ticks_usec();
+	pre_step_time = time_update - time_begin;
+
 	const JPH::EPhysicsUpdateError update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
 
+	const uint64_t time_post_step = Time::get_singleton()->get_ticks_usec();
+	update_time = time_post_step - time_update;
+
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) != JPH::EPhysicsUpdateError::None) {
 		WARN_PRINT_ONCE(vformat("Jolt Physics manifold cache exceeded capacity and contacts were ignored. "
 								"Consider increasing maximum number of contact constraints in project settings. "
@@ -188,22 +200,46 @@ void JoltSpace3D::step(float p_step) {
 
 	_post_step(p_step);
 
+	post_step_time = Time::get_singleton()->get_ticks_usec() - time_post_step;
+
 	bodies_added_since_optimizing = 0;
 	stepping = false;
 }
 
+int JoltSpace3D::_get_update_phase_time(JoltJobSystem::JobPhase p_phase) const {
+	// Jobs run concurrently on several threads, so the wall time of the update is split between the phases according
+	// to their share of the job time. Job timings are only recorded in debug builds, so this is zero otherwise.
+	uint64_t total_job_time = 0;
+	for (uint64_t job_timing : job_timings) {
+		total_job_time += job_timing;
+	}
+
+	if (total_job_time == 0) {
+		return 0;
+	}
+
+	return int(update_time * job_timings[p_phase] / total_job_time);
+}
+
 void JoltSpace3D::call_queries() {
+	const uint64_t time_begin = Time::get_singleton()->get_ticks_usec();
+
 	while (body_call_queries_list.first()) {
 		JoltBody3D *body = body_call_queries_list.first()->self();
 		body_call_queries_list.remove(body_call_queries_list.first());
 		body->call_queries();
 	}
 
+	const uint64_t time_areas = Time::get_singleton()->get_ticks_usec();
+	state_sync_time = time_areas - time_begin;
+
 	while (area_call_queries_list.first()) {
 		JoltArea3D *body = area_call_queries_list.first()->self();
 		area_call_queries_list.remove(area_call_queries_list.first());
 		body->call_queries();
 	}
+
+	area_callback_time = Time::get_singleton()->get_ticks_usec() - time_areas;
 }
 
 double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
@@ -270,6 +306,41 @@ void JoltSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, double p_va
 	}
 }
 
+int JoltSpace3D::get_process_info(PhysicsServer3D::ProcessInfo p_info) const {
+	switch (p_info) {
+		case PhysicsServer3D::INFO_ACTIVE_OBJECTS: {
+			return int(physics_system->GetNumActiveBodies(JPH::EBodyType::RigidBody) + physics_system->GetNumActiveBodies(JPH::EBodyType::SoftBody));
+		}
+		case PhysicsServer3D::INFO_STEP_TIME: {
+			return int(pre_step_time + update_time + post_step_time);
+		}
+		case PhysicsServer3D::INFO_BROAD_PHASE_TIME: {
+			return _get_update_phase_time(JoltJobSystem::JOB_PHASE_BROAD_PHASE);
+		}
+		case PhysicsServer3D::INFO_NARROW_PHASE_TIME: {
+			// Contacts and area overlaps are flushed in `_post_step`, so it counts toward the narrow phase.
+			return _get_update_phase_time(JoltJobSystem::JOB_PHASE_NARROW_PHASE) + int(post_step_time);
+		}
+		case PhysicsServer3D::INFO_SOLVER_TIME: {
+			return _get_update_phase_time(JoltJobSystem::JOB_PHASE_SOLVER);
+		}
+		case PhysicsServer3D::INFO_INTEGRATION_TIME: {
+			// Forces and kinematic motion are applied in `_pre_step`, so it counts toward the integration.
+			return _get_update_phase_time(JoltJobSystem::JOB_PHASE_INTEGRATION) + int(pre_step_time);
+		}
+		case PhysicsServer3D::INFO_STATE_SYNC_TIME: {
+			return int(state_sync_time);
+		}
+		case PhysicsServer3D::INFO_AREA_CALLBACK_TIME: {
+			return int(area_callback_time);
+		}
+		default: {
+			// Collision pairs and islands are internal to Jolt and not exposed.
+			return 0;
+		}
+	}
+}
+
 JPH::BodyInterface &JoltSpace3D::get_body_iface() {
 	return physics_system->GetBodyInterfaceNoLock();
 }
@@ -322,6 +393,43 @@ JoltWritableBodies3D JoltSpace3D::write_bodies(const JPH::BodyID *p_body_ids, in
 	return JoltWritableBodies3D(*this, p_body_ids, p_body_count);
 }
 
+Vector<uint8_t> JoltSpace3D::save_state() {
+	state_buffer.clear();
+	JoltStateRecorder recorder(state_buffer);
+	recorder.Write(STATE_MAGIC);
+	recorder.Write(STATE_VERSION);
+	const uint32_t size_position = state_buffer.size();
+	recorder.Write(uint32_t(0));
+	physics_system->SaveState(recorder, JPH::EStateRecorderState::All);
+	ERR_FAIL_COND_V(recorder.IsFailed(), Vector<uint8_t>());
+
+	const uint32_t size = state_buffer.size() - size_position - sizeof(uint32_t);
+	memcpy(state_buffer.ptr() + size_position, &size, sizeof(uint32_t));
+
+	Vector<uint8_t> state;
+	state.resize(state_buffer.size());
+	memcpy(state.ptrw(), state_buffer.ptr(), state_buffer.size());
+	return state;
+}
+
+Error JoltSpace3D::restore_state(const Vector<uint8_t> &p_state) {
+	JoltStateRecorder recorder(p_state.ptr(), p_state.size());
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	uint32_t size = 0;
+	recorder.Read(magic);
+	recorder.Read(version);
+	recorder.Read(size);
+	// Jolt restores as it reads, so truncated states must be caught before they leave bodies half restored.
+	ERR_FAIL_COND_V_MSG(recorder.IsFailed() || magic != STATE_MAGIC || version != STATE_VERSION || size != p_state.size() - 3 * sizeof(uint32_t), ERR_INVALID_DATA, "Invalid physics space state.");
+
+	// Jolt matches bodies by ID, which fails if a body was removed from the space after the state was saved.
+	const bool restored = physics_system->RestoreState(recorder);
+	ERR_FAIL_COND_V_MSG(!restored || recorder.IsFailed() || !recorder.IsEOF(), ERR_INVALID_DATA, "Invalid physics space state, or bodies were removed from the space since it was saved.");
+
+	return OK;
+}
+
 JoltPhysicsDirectSpaceState3D *JoltSpace3D::get_direct_state() {
 	if (direct_state == nullptr) {
 		direct_state = memnew(JoltPhysicsDirectSpaceState3D(this));
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "jolt_body_accessor_3d.h"
+#include "jolt_job_system.h"
 
 #include "servers/physics_server_3d.h"
 
@@ -73,12 +74,25 @@ class JoltSpace3D {
 
 	int bodies_added_since_optimizing = 0;
 
+	// Timings of the last step and query flush, in microseconds.
+	uint64_t pre_step_time = 0;
+	uint64_t update_time = 0;
+	uint64_t post_step_time = 0;
+	uint64_t state_sync_time = 0;
+	uint64_t area_callback_time = 0;
+	uint64_t job_timings[JoltJobSystem::JOB_PHASE_MAX] = {};
+
+	// Reused between calls to save_state(), to avoid reallocating every frame.
+	LocalVector<uint8_t> state_buffer;
+
 	bool active = false;
 	bool stepping = false;
 
 	void _pre_step(float p_step);
 	void _post_step(float p_step);
 
+	int _get_update_phase_time(JoltJobSystem::JobPhase p_phase) const;
+
 public:
 	explicit JoltSpace3D(JPH::JobSystem *p_job_system);
 	~JoltSpace3D();
@@ -98,8 +112,14 @@ public:
 	double get_param(PhysicsServer3D::SpaceParameter p_param) const;
 	void set_param(PhysicsServer3D::SpaceParameter p_param, double p_value);
 
+	int get_process_info(PhysicsServer3D::ProcessInfo p_info) const;
+	void set_job_timing(JoltJobSystem::JobPhase p_phase, uint64_t p_time) { job_timings[p_phase] = p_time; }
+
 	JPH::PhysicsSystem &get_physics_system() const { return *physics_system; }
 
+	Vector<uint8_t> save_state();
+	Error restore_state(const Vector<uint8_t> &p_state);
+
 	JPH::TempAllocator &get_temp_allocator() const { return *temp_allocator; }
 
 	JPH::BodyInterface &get_body_iface();
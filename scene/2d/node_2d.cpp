@@ -446,6 +446,19 @@ void Node2D::_notification(int p_notification) {
 	}
 }
 
+StringName Node2D::_duplicate_state(Node *p_copy) const {
+	if (CanvasItem::_duplicate_state(p_copy) != SNAME("CanvasItem")) {
+		return StringName();
+	}
+
+	Node2D *copy = Object::cast_to<Node2D>(p_copy);
+	copy->set_position(get_position());
+	copy->set_rotation(get_rotation());
+	copy->set_scale(get_scale());
+	copy->set_skew(get_skew());
+	return SNAME("Node2D");
+}
+
 void Node2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_position", "position"), &Node2D::set_position);
 	ClassDB::bind_method(D_METHOD("set_rotation", "radians"), &Node2D::set_rotation);
@@ -54,6 +54,8 @@ protected:
 	void _notification(int p_notification);
 	static void _bind_methods();
 
+	virtual StringName _duplicate_state(Node *p_copy) const override;
+
 public:
 #ifdef TOOLS_ENABLED
 	virtual Dictionary _edit_get_state() const override;
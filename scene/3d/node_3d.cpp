@@ -108,17 +108,31 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	_propagate_transform_changed_pass(get_tree()->xform_change_pass);
+}
+
+bool Node3D::_propagate_transform_changed_pass(uint32_t p_pass) {
+	// Returns whether the whole subtree is dirty and has its notifications queued, so that
+	// further changes of ancestors before the next flush can skip it entirely. This keeps
+	// deep hierarchies where many nodes move every frame from being walked once per node.
+	bool subtree_queued = true;
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
-		E->_propagate_transform_changed(p_origin);
+		if (E->data.xform_change_pass == p_pass && E->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+			continue; // Nothing left to do in this subtree until the next flush.
+		}
+		subtree_queued = E->_propagate_transform_changed_pass(p_pass) && subtree_queued;
 	}
+
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	const bool notify = !data.gizmos.is_empty() || data.notify_transform;
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	const bool notify = data.notify_transform;
 #endif
+	if (notify && !data.ignore_notification && !xform_change.in_list()) {
 		if (likely(is_accessible_from_caller_thread())) {
 			get_tree()->xform_change_list.add(&xform_change);
 		} else {
@@ -126,7 +140,29 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
 		}
 	}
+	if (notify && !xform_change.in_list()) {
+		subtree_queued = false;
+	}
+
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	data.xform_change_pass = subtree_queued ? p_pass : 0;
+	return subtree_queued;
+}
+
+void Node3D::_invalidate_transform_changed_pass() {
+	// A notification of this subtree is no longer queued, so neither this node nor its
+	// ancestors can be skipped anymore. Ancestors are only marked when all their descendants are.
+	if (!is_inside_tree()) {
+		return;
+	}
+
+	const uint32_t pass = get_tree()->xform_change_pass;
+	data.xform_change_pass = 0;
+	Node3D *node = data.top_level ? nullptr : data.parent;
+	while (node && node->data.xform_change_pass == pass) {
+		node->data.xform_change_pass = 0;
+		node = node->data.top_level ? nullptr : node->data.parent;
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -158,6 +194,7 @@ void Node3D::_notification(int p_what) {
 			}
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
+			_invalidate_transform_changed_pass();
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -171,6 +208,7 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
+			data.xform_change_pass = 0;
 			if (data.C) {
 				data.parent->data.children.erase(data.C);
 			}
@@ -732,6 +770,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_changed_pass();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -871,6 +910,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_changed_pass();
 }
 
 void Node3D::set_as_top_level_keep_local(bool p_enabled) {
@@ -879,6 +919,7 @@ void Node3D::set_as_top_level_keep_local(bool p_enabled) {
 		return;
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_changed_pass();
 	_propagate_transform_changed(this);
 }
 
@@ -1087,6 +1128,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	_invalidate_transform_changed_pass();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -1111,6 +1153,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_transform_changed_pass();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
@@ -1179,6 +1222,21 @@ void Node3D::_validate_property(PropertyInfo &p_property) const {
 	}
 }
 
+StringName Node3D::_duplicate_state(Node *p_copy) const {
+	if (Node::_duplicate_state(p_copy) != SNAME("Node")) {
+		return StringName();
+	}
+
+	Node3D *copy = Object::cast_to<Node3D>(p_copy);
+	copy->set_transform(get_transform());
+	copy->set_rotation_edit_mode(get_rotation_edit_mode());
+	copy->set_rotation_order(get_rotation_order());
+	copy->set_as_top_level(is_set_as_top_level());
+	copy->set_visible(is_visible());
+	copy->set_visibility_parent(get_visibility_parent());
+	return SNAME("Node3D");
+}
+
 bool Node3D::_property_can_revert(const StringName &p_name) const {
 	const String sname = p_name;
 	if (sname == "basis") {
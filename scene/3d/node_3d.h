@@ -106,6 +106,10 @@ private:
 
 		mutable MTNumeric<uint32_t> dirty;
 
+		// Transform notification pass (see SceneTree::xform_change_pass) since which the global transform
+		// of the whole subtree is dirty and all of its notifications are queued, or 0.
+		uint32_t xform_change_pass = 0;
+
 		Viewport *viewport = nullptr;
 
 		bool top_level : 1;
@@ -150,6 +154,8 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	bool _propagate_transform_changed_pass(uint32_t p_pass);
+	void _invalidate_transform_changed_pass();
 
 	void _propagate_visibility_changed();
 
@@ -172,6 +178,7 @@ protected:
 	static void _bind_methods();
 
 	void _validate_property(PropertyInfo &p_property) const;
+	virtual StringName _duplicate_state(Node *p_copy) const override;
 
 	bool _property_can_revert(const StringName &p_name) const;
 	bool _property_get_revert(const StringName &p_name, Variant &r_property) const;
@@ -577,6 +577,57 @@ void Control::_validate_property(PropertyInfo &p_property) const {
 	}
 }
 
+StringName Control::_duplicate_state(Node *p_copy) const {
+	// The shortcut context may be a node of the duplicated tree, which needs remapping.
+	// Which theme overrides are stored depends on the theme items of the class.
+	if (data.shortcut_context.is_valid() || !data.theme_icon_override.is_empty() || !data.theme_style_override.is_empty() || !data.theme_font_override.is_empty() ||
+			!data.theme_font_size_override.is_empty() || !data.theme_color_override.is_empty() || !data.theme_constant_override.is_empty()) {
+		return StringName();
+	}
+	if (CanvasItem::_duplicate_state(p_copy) != SNAME("CanvasItem")) {
+		return StringName();
+	}
+
+	Control *copy = Object::cast_to<Control>(p_copy);
+	// Same result as setting the layout properties in order, without recomputing offsets against the parent in between.
+	copy->data.stored_layout_mode = _get_layout_mode();
+	copy->data.stored_use_custom_anchors = _get_anchors_layout_preset() == -1;
+	for (int i = 0; i < 4; i++) {
+		copy->data.anchor[i] = data.anchor[i];
+		copy->data.offset[i] = data.offset[i];
+	}
+	copy->_size_changed();
+	copy->set_h_grow_direction(get_h_grow_direction());
+	copy->set_v_grow_direction(get_v_grow_direction());
+
+	copy->set_clip_contents(data.clip_contents);
+	copy->set_custom_minimum_size(get_custom_minimum_size());
+	copy->set_layout_direction(get_layout_direction());
+	copy->set_rotation(get_rotation());
+	copy->set_scale(get_scale());
+	copy->set_pivot_offset(get_pivot_offset());
+	copy->set_h_size_flags(get_h_size_flags());
+	copy->set_v_size_flags(get_v_size_flags());
+	copy->set_stretch_ratio(get_stretch_ratio());
+	copy->set_localize_numeral_system(is_localizing_numeral_system());
+	copy->set_tooltip_text(get_tooltip_text());
+	copy->set_tooltip_auto_translate_mode(get_tooltip_auto_translate_mode());
+	for (int i = 0; i < 4; i++) {
+		copy->set_focus_neighbor(Side(i), get_focus_neighbor(Side(i)));
+	}
+	copy->set_focus_next(get_focus_next());
+	copy->set_focus_previous(get_focus_previous());
+	copy->set_focus_mode(get_focus_mode());
+	copy->set_focus_recursive_behavior(get_focus_recursive_behavior());
+	copy->set_mouse_filter(get_mouse_filter());
+	copy->set_mouse_recursive_behavior(get_mouse_recursive_behavior());
+	copy->set_force_pass_scroll_events(is_force_pass_scroll_events());
+	copy->set_default_cursor_shape(get_default_cursor_shape());
+	copy->set_theme(get_theme());
+	copy->set_theme_type_variation(get_theme_type_variation());
+	return SNAME("Control");
+}
+
 bool Control::_property_can_revert(const StringName &p_name) const {
 	if (p_name == "layout_mode" || p_name == "anchors_preset") {
 		return true;
@@ -357,6 +357,7 @@ protected:
 
 	bool _property_can_revert(const StringName &p_name) const;
 	bool _property_get_revert(const StringName &p_name, Variant &r_property) const;
+	virtual StringName _duplicate_state(Node *p_copy) const override;
 
 	// Theming.
 
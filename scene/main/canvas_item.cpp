@@ -619,6 +619,33 @@ void CanvasItem::_get_property_list(List<PropertyInfo> *p_list) const {
 	}
 }
 
+StringName CanvasItem::_duplicate_state(Node *p_copy) const {
+	if (Node::_duplicate_state(p_copy) != SNAME("Node")) {
+		return StringName();
+	}
+
+	CanvasItem *copy = Object::cast_to<CanvasItem>(p_copy);
+	copy->set_visible(is_visible());
+	copy->set_modulate(get_modulate());
+	copy->set_self_modulate(get_self_modulate());
+	copy->set_draw_behind_parent(is_draw_behind_parent_enabled());
+	copy->set_as_top_level(is_set_as_top_level());
+	copy->set_clip_children_mode(get_clip_children_mode());
+	copy->set_light_mask(get_light_mask());
+	copy->set_visibility_layer(get_visibility_layer());
+	copy->set_z_index(get_z_index());
+	copy->set_z_as_relative(is_z_relative());
+	copy->set_y_sort_enabled(is_y_sort_enabled());
+	copy->set_texture_filter(get_texture_filter());
+	copy->set_texture_repeat(get_texture_repeat());
+	copy->set_material(get_material());
+	copy->set_use_parent_material(get_use_parent_material());
+	for (const KeyValue<StringName, Variant> &E : instance_shader_parameters) {
+		copy->set_instance_shader_parameter(E.key, E.value.duplicate(true));
+	}
+	return SNAME("CanvasItem");
+}
+
 void CanvasItem::item_rect_changed(bool p_size_changed) {
 	ERR_MAIN_THREAD_GUARD;
 	if (p_size_changed) {
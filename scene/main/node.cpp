@@ -44,8 +44,54 @@
 #include "viewport.h"
 
 int Node::orphan_node_count = 0;
+SafeNumeric<uint32_t> Node::path_caching_node_count;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
+#ifdef DEBUG_ENABLED
+thread_local Node *Node::current_process_thread_group_probe = nullptr;
+
+void Node::_report_thread_group_access(const char *p_function, bool p_main_thread_only) const {
+	Node *owner = current_process_thread_group ? current_process_thread_group : current_process_thread_group_probe;
+	if (owner->data.process_thread_group != PROCESS_THREAD_GROUP_AUTOMATIC || !owner->data.tree) {
+		return; // Other thread groups are set up by hand, nothing to learn.
+	}
+	owner->data.tree->_report_thread_group_access(owner, this, p_function, p_main_thread_only);
+}
+
+// Whether a call to p_method has a result the caller may use. Unknown methods count as such.
+static bool _method_has_result(const Object *p_object, const StringName &p_method) {
+	const ScriptInstance *si = p_object->get_script_instance();
+	if (si && si->has_method(p_method)) {
+		for (Ref<Script> script = si->get_script(); script.is_valid(); script = script->get_base_script()) {
+			if (script->has_method(p_method)) {
+				const PropertyInfo return_val = script->get_method_info(p_method).return_val;
+				return return_val.type != Variant::NIL || (return_val.usage & PROPERTY_USAGE_NIL_IS_VARIANT);
+			}
+		}
+		return true;
+	}
+	const MethodBind *method = ClassDB::get_method(p_object->get_class_name(), p_method);
+	return !method || method->has_return();
+}
+
+Variant Node::callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	// Only automatic thread groups moved to a sub-thread can run into this, as they were checked
+	// for a limited time. The group is moved back to the main thread as soon as its current pass
+	// ends. Until then, calls into nodes outside of it that return nothing are run when the thread
+	// group of that node processes its messages, the others fail instead of returning a made up value.
+	if (unlikely(current_process_thread_group != nullptr) && current_process_thread_group->data.process_thread_group == PROCESS_THREAD_GROUP_AUTOMATIC && data.inside_tree && !is_accessible_from_caller_thread()) {
+		_report_thread_group_access(String(p_method).utf8().get_data(), false);
+		if (_method_has_result(this, p_method)) {
+			r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+			ERR_FAIL_V_MSG(Variant(), vformat("Can't call %s() on %s from the automatic thread group of %s, which runs on a sub-thread. The thread group will be processed on the main thread from now on.", p_method, get_description(), current_process_thread_group->get_description()));
+		}
+		call_deferred_thread_groupp(p_method, p_args, p_argcount, true);
+		r_error.error = Callable::CallError::CALL_OK;
+		return Variant();
+	}
+	return Object::callp(p_method, p_args, p_argcount, r_error);
+}
+#endif
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -221,6 +267,14 @@ void Node::_notification(int p_notification) {
 			if (GDVIRTUAL_IS_OVERRIDDEN(_physics_process)) {
 				set_physics_process(true);
 			}
+			if (GDVIRTUAL_IS_OVERRIDDEN(_process_batch)) {
+				set_process_batched(true);
+				set_process(true);
+			}
+			if (GDVIRTUAL_IS_OVERRIDDEN(_physics_process_batch)) {
+				set_process_batched(true);
+				set_physics_process(true);
+			}
 
 			GDVIRTUAL_CALL(_ready);
 		} break;
@@ -1020,6 +1074,63 @@ void Node::set_process_internal(bool p_process_internal) {
 	}
 }
 
+void Node::set_process_batched(bool p_batched) {
+	ERR_THREAD_GUARD
+	if (data.process_batched == p_batched) {
+		return;
+	}
+
+	if (!is_inside_tree() || !_is_any_processing()) {
+		data.process_batched = p_batched;
+		return;
+	}
+
+	// Process lists keep count of their batched nodes, so update it by leaving and entering them again.
+	_remove_from_process_thread_group();
+	data.process_batched = p_batched;
+	_add_to_process_thread_group();
+}
+
+bool Node::is_process_batched() const {
+	return data.process_batched;
+}
+
+void Node::_process_batch(double p_delta, Span<Node *> p_nodes) {
+	if (GDVIRTUAL_IS_OVERRIDDEN(_process_batch)) {
+		TypedArray<Node> nodes;
+		nodes.resize(p_nodes.size());
+		for (uint64_t i = 0; i < p_nodes.size(); i++) {
+			nodes[i] = p_nodes.ptr()[i];
+		}
+		GDVIRTUAL_CALL(_process_batch, p_delta, nodes);
+		return;
+	}
+
+	for (Node *node : p_nodes) {
+		node->notification(NOTIFICATION_PROCESS);
+	}
+}
+
+void Node::_physics_process_batch(double p_delta, Span<Node *> p_nodes) {
+	if (GDVIRTUAL_IS_OVERRIDDEN(_physics_process_batch)) {
+		TypedArray<Node> nodes;
+		nodes.resize(p_nodes.size());
+		for (uint64_t i = 0; i < p_nodes.size(); i++) {
+			nodes[i] = p_nodes.ptr()[i];
+		}
+		GDVIRTUAL_CALL(_physics_process_batch, p_delta, nodes);
+		return;
+	}
+
+	for (Node *node : p_nodes) {
+		node->notification(NOTIFICATION_PHYSICS_PROCESS);
+	}
+}
+
+bool Node::_has_process_batch(bool p_physics) const {
+	return p_physics ? GDVIRTUAL_IS_OVERRIDDEN(_physics_process_batch) : GDVIRTUAL_IS_OVERRIDDEN(_process_batch);
+}
+
 void Node::_add_process_group() {
 	get_tree()->_add_process_group(this);
 }
@@ -1403,6 +1514,7 @@ void Node::set_name(const String &p_name) {
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
 		ERR_FAIL_COND_MSG(!success, "Renaming child in hashtable failed, this is a bug.");
 	}
+	_path_structure_changed();
 
 	if (data.unique_name_in_owner && data.owner) {
 		_acquire_unique_name_in_owner();
@@ -1619,6 +1731,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 	}
 
 	p_child->data.parent = this;
+	p_child->_path_structure_changed(); // The child too, paths leaving its subtree through ".." now lead somewhere.
 
 	if (!data.children_cache_dirty && p_internal_mode == INTERNAL_MODE_DISABLED && data.internal_children_back_count_cache == 0) {
 		// Special case, also add to the cached children array since its cheap.
@@ -1703,6 +1816,7 @@ void Node::remove_child(Node *p_child) {
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+	p_child->_path_structure_changed();
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
@@ -1806,6 +1920,34 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	if (unlikely(data.node_path_cache)) {
+		return _get_node_cached(p_path);
+	}
+	return _resolve_node_path(p_path, nullptr);
+}
+
+Node *Node::_get_node_cached(const NodePath &p_path) const {
+	CachedNodePath *cached = data.node_path_cache->getptr(p_path);
+	if (cached) {
+		const Node *scope = cached->scope == get_instance_id() ? this : static_cast<Node *>(ObjectDB::get_instance(cached->scope));
+		if (scope && scope->data.path_version == cached->scope_version) {
+			return cached->target.is_valid() ? static_cast<Node *>(ObjectDB::get_instance(cached->target)) : nullptr;
+		}
+	} else if (data.node_path_cache->size() >= MAX_CACHED_NODE_PATHS) {
+		data.node_path_cache->clear(); // Paths built on the fly, don't let them pile up.
+	}
+
+	Node *scope = nullptr;
+	Node *node = _resolve_node_path(p_path, &scope);
+
+	CachedNodePath &entry = cached ? *cached : data.node_path_cache->insert(p_path, CachedNodePath())->value;
+	entry.target = node ? node->get_instance_id() : ObjectID();
+	entry.scope = scope->get_instance_id();
+	entry.scope_version = scope->data.path_version;
+	return node;
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path, Node **r_scope) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1818,6 +1960,11 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		}
 	}
 
+	// When requested, keep track of the highest node the result depends on (see _get_node_cached()).
+	if (r_scope) {
+		*r_scope = current ? current : root;
+	}
+
 	for (int i = 0; i < p_path.get_name_count(); i++) {
 		StringName name = p_path.get_name(i);
 		Node *next = nullptr;
@@ -1831,6 +1978,9 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 			next = current->data.parent;
+			if (r_scope && *r_scope == current) {
+				*r_scope = next;
+			}
 		} else if (current == nullptr) {
 			if (name == root->get_name()) {
 				next = root;
@@ -1839,7 +1989,11 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		} else if (name.is_node_unique_name()) {
 			Node **unique = current->data.owned_unique_nodes.getptr(name);
 			if (!unique && current->data.owner) {
-				unique = current->data.owner->data.owned_unique_nodes.getptr(name);
+				Node *owner = current->data.owner;
+				unique = owner->data.owned_unique_nodes.getptr(name);
+				if (r_scope && *r_scope != owner && !(*r_scope)->is_ancestor_of(owner)) {
+					*r_scope = owner; // Owners are ancestors, so this one is above the scope.
+				}
 			}
 			if (!unique) {
 				return nullptr;
@@ -2117,6 +2271,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
 	data.OW = data.owner->data.owned.back();
+	_path_structure_changed(); // Unique names are looked up through the owner.
 
 	owner_changed_notify();
 }
@@ -2129,6 +2284,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	data.owner->_path_structure_changed();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2143,6 +2299,27 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	data.owner->_path_structure_changed();
+}
+
+void Node::set_cache_node_paths(bool p_enabled) {
+	ERR_THREAD_GUARD
+	if (p_enabled == (data.node_path_cache != nullptr)) {
+		return;
+	}
+
+	if (p_enabled) {
+		data.node_path_cache = memnew((HashMap<NodePath, CachedNodePath>));
+		path_caching_node_count.increment();
+	} else {
+		memdelete(data.node_path_cache);
+		data.node_path_cache = nullptr;
+		path_caching_node_count.decrement();
+	}
+}
+
+bool Node::is_caching_node_paths() const {
+	return data.node_path_cache != nullptr;
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2216,6 +2393,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	_path_structure_changed();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -2975,6 +3153,16 @@ void Node::_emit_editor_state_changed() {
 // This has to be called after nodes have been duplicated since there might be properties
 // of type Node that can be updated properly only if duplicated node tree is complete.
 void Node::_duplicate_properties(const Node *p_root, const Node *p_original, Node *p_copy, int p_flags) const {
+	// Native classes that know how to copy themselves skip the property list entirely.
+	if (p_original->get_script().get_type() == Variant::NIL && p_original->_duplicate_state(p_copy) == p_original->get_class_name()) {
+		for (int i = 0; i < p_original->get_child_count(false); i++) {
+			Node *copy_child = p_copy->get_child(i, false);
+			ERR_FAIL_NULL_MSG(copy_child, "Child node disappeared while duplicating.");
+			_duplicate_properties(p_root, p_original->get_child(i, false), copy_child, p_flags);
+		}
+		return;
+	}
+
 	List<PropertyInfo> props;
 	p_original->get_property_list(&props);
 	const StringName &script_property_name = CoreStringName(script);
@@ -3034,6 +3222,34 @@ void Node::_duplicate_properties(const Node *p_root, const Node *p_original, Nod
 	}
 }
 
+StringName Node::_duplicate_state(Node *p_copy) const {
+	List<StringName> meta;
+	get_meta_list(&meta);
+	for (const StringName &E : meta) {
+		if (get_meta(E).get_type() == Variant::OBJECT || get_meta(E).get_type() == Variant::ARRAY) {
+			return StringName(); // May reference nodes in the duplicated tree, needs remapping.
+		}
+	}
+	for (const StringName &E : meta) {
+		p_copy->set_meta(E, get_meta(E).duplicate(true));
+	}
+
+	p_copy->set_import_path(get_import_path());
+	p_copy->set_unique_name_in_owner(is_unique_name_in_owner());
+	p_copy->set_cache_node_paths(is_caching_node_paths());
+	p_copy->set_process_mode(get_process_mode());
+	p_copy->set_process_priority(get_process_priority());
+	p_copy->set_physics_process_priority(get_physics_process_priority());
+	p_copy->set_process_batched(is_process_batched());
+	p_copy->set_process_thread_group(get_process_thread_group());
+	p_copy->set_process_thread_group_order(get_process_thread_group_order());
+	p_copy->set_process_thread_messages(get_process_thread_messages());
+	p_copy->set_physics_interpolation_mode(get_physics_interpolation_mode());
+	p_copy->set_auto_translate_mode(get_auto_translate_mode());
+	p_copy->set_editor_description(get_editor_description());
+	return SNAME("Node");
+}
+
 // Duplication of signals must happen after all the node descendants have been copied,
 // because re-targeting of connections from some descendant to another is not possible
 // if the emitter node comes later in tree order than the receiver
@@ -3268,28 +3484,34 @@ void Node::_set_tree(SceneTree *p_tree) {
 
 	//ERR_FAIL_COND(p_scene && data.parent && !data.parent->data.scene); //nobug if both are null
 
+	// Batch the whole subtree, so the tree applies group and process list removals in bulk
+	// and emits tree_changed once.
 	if (data.tree) {
-		_propagate_exit_tree();
-
 		tree_changed_a = data.tree;
+		tree_changed_a->_begin_tree_batch();
+
+		_propagate_exit_tree();
 	}
 
 	data.tree = p_tree;
 
 	if (data.tree) {
+		tree_changed_b = data.tree;
+		tree_changed_b->_begin_tree_batch();
+
 		_propagate_enter_tree();
 		if (!data.parent || data.parent->data.ready_notified) { // No parent (root) or parent ready
 			_propagate_ready(); //reverse_notification(NOTIFICATION_READY);
 		}
-
-		tree_changed_b = data.tree;
 	}
 
 	if (tree_changed_a) {
 		tree_changed_a->tree_changed();
+		tree_changed_a->_end_tree_batch();
 	}
 	if (tree_changed_b) {
 		tree_changed_b->tree_changed();
+		tree_changed_b->_end_tree_batch();
 	}
 }
 
@@ -3677,6 +3899,8 @@ void Node::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_process_internal", "enable"), &Node::set_process_internal);
 	ClassDB::bind_method(D_METHOD("is_processing_internal"), &Node::is_processing_internal);
+	ClassDB::bind_method(D_METHOD("set_process_batched", "enable"), &Node::set_process_batched);
+	ClassDB::bind_method(D_METHOD("is_process_batched"), &Node::is_process_batched);
 
 	ClassDB::bind_method(D_METHOD("set_physics_process_internal", "enable"), &Node::set_physics_process_internal);
 	ClassDB::bind_method(D_METHOD("is_physics_processing_internal"), &Node::is_physics_processing_internal);
@@ -3728,6 +3952,8 @@ void Node::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_unique_name_in_owner", "enable"), &Node::set_unique_name_in_owner);
 	ClassDB::bind_method(D_METHOD("is_unique_name_in_owner"), &Node::is_unique_name_in_owner);
+	ClassDB::bind_method(D_METHOD("set_cache_node_paths", "enable"), &Node::set_cache_node_paths);
+	ClassDB::bind_method(D_METHOD("is_caching_node_paths"), &Node::is_caching_node_paths);
 
 	ClassDB::bind_method(D_METHOD("atr", "message", "context"), &Node::atr, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("atr_n", "message", "plural_message", "n", "context"), &Node::atr_n, DEFVAL(""));
@@ -3835,6 +4061,7 @@ void Node::_bind_methods() {
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_INHERIT);
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_MAIN_THREAD);
 	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_SUB_THREAD);
+	BIND_ENUM_CONSTANT(PROCESS_THREAD_GROUP_AUTOMATIC);
 
 	BIND_BITFIELD_FLAG(FLAG_PROCESS_THREAD_MESSAGES);
 	BIND_BITFIELD_FLAG(FLAG_PROCESS_THREAD_MESSAGES_PHYSICS);
@@ -3872,6 +4099,7 @@ void Node::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "name", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_name", "get_name");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "unique_name_in_owner", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR), "set_unique_name_in_owner", "is_unique_name_in_owner");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "cache_node_paths"), "set_cache_node_paths", "is_caching_node_paths");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "scene_file_path", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_scene_file_path", "get_scene_file_path");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "owner", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "set_owner", "get_owner");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "multiplayer", PROPERTY_HINT_RESOURCE_TYPE, "MultiplayerAPI", PROPERTY_USAGE_NONE), "", "get_multiplayer");
@@ -3880,9 +4108,10 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,When Paused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_physics_priority"), "set_physics_process_priority", "get_physics_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_batched"), "set_process_batched", "is_process_batched");
 
 	ADD_SUBGROUP("Thread Group", "process_thread");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread,Automatic"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
 
@@ -3897,6 +4126,8 @@ void Node::_bind_methods() {
 
 	GDVIRTUAL_BIND(_process, "delta");
 	GDVIRTUAL_BIND(_physics_process, "delta");
+	GDVIRTUAL_BIND(_process_batch, "delta", "nodes");
+	GDVIRTUAL_BIND(_physics_process_batch, "delta", "nodes");
 	GDVIRTUAL_BIND(_enter_tree);
 	GDVIRTUAL_BIND(_exit_tree);
 	GDVIRTUAL_BIND(_ready);
@@ -3935,6 +4166,8 @@ Node::Node() {
 	data.physics_process_internal = false;
 	data.process_internal = false;
 
+	data.process_batched = false;
+
 	data.input = false;
 	data.shortcut_input = false;
 	data.unhandled_input = false;
@@ -3956,6 +4189,10 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+		path_caching_node_count.decrement();
+	}
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
@@ -79,6 +79,7 @@ public:
 		PROCESS_THREAD_GROUP_INHERIT,
 		PROCESS_THREAD_GROUP_MAIN_THREAD,
 		PROCESS_THREAD_GROUP_SUB_THREAD,
+		PROCESS_THREAD_GROUP_AUTOMATIC,
 	};
 
 	enum ProcessThreadMessages {
@@ -155,6 +156,15 @@ private:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.physics_process_priority == p_a->data.physics_process_priority ? p_b->is_greater_than(p_a) : p_b->data.physics_process_priority > p_a->data.physics_process_priority; }
 	};
 
+	static const int MAX_CACHED_NODE_PATHS = 256;
+
+	struct CachedNodePath {
+		ObjectID target;
+		// Highest node the path was resolved through, any change to the names below it invalidates the result.
+		ObjectID scope;
+		uint32_t scope_version = 0;
+	};
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -168,6 +178,9 @@ private:
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
+		// Increased when a node is added, removed, renamed or made unique anywhere in this subtree.
+		uint32_t path_version = 0;
+		HashMap<NodePath, CachedNodePath> *node_path_cache = nullptr;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
 		mutable int internal_children_back_count_cache = 0;
@@ -213,6 +226,8 @@ private:
 		bool physics_process_internal : 1;
 		bool process_internal : 1;
 
+		bool process_batched : 1;
+
 		bool input : 1;
 		bool shortcut_input : 1;
 		bool unhandled_input : 1;
@@ -295,6 +310,19 @@ private:
 	friend class SceneTree;
 
 	void _set_tree(SceneTree *p_tree);
+
+	// Versions only need to be kept while some node caches paths, caches start out empty.
+	static SafeNumeric<uint32_t> path_caching_node_count;
+	_FORCE_INLINE_ void _path_structure_changed() {
+		if (likely(path_caching_node_count.get() == 0)) {
+			return;
+		}
+		for (Node *node = this; node; node = node->data.parent) {
+			node->data.path_version++;
+		}
+	}
+	Node *_resolve_node_path(const NodePath &p_path, Node **r_scope) const;
+	Node *_get_node_cached(const NodePath &p_path) const;
 	void _propagate_pause_notification(bool p_enable);
 	void _propagate_suspend_notification(bool p_enable);
 
@@ -323,6 +351,11 @@ private:
 	void _add_tree_to_process_thread_group(Node *p_owner);
 
 	static thread_local Node *current_process_thread_group;
+#ifdef DEBUG_ENABLED
+	// Owner of the automatic thread group being checked for thread safety while processed on the main thread.
+	static thread_local Node *current_process_thread_group_probe;
+	void _report_thread_group_access(const char *p_function, bool p_main_thread_only) const;
+#endif
 
 	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_thread_safe_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
@@ -375,14 +408,27 @@ protected:
 
 	void _validate_property(PropertyInfo &p_property) const;
 
+	// Fast path for duplicate(), copies the stored state of this class and its parents to p_copy without going
+	// through the property list. Returns the class that was copied, or an empty name if the property list must be used.
+	// Overrides must call the parent implementation first, and only copy the properties they add.
+	virtual StringName _duplicate_state(Node *p_copy) const;
+
 protected:
 	virtual void input(const Ref<InputEvent> &p_event);
 	virtual void shortcut_input(const Ref<InputEvent> &p_key_event);
 	virtual void unhandled_input(const Ref<InputEvent> &p_event);
 	virtual void unhandled_key_input(const Ref<InputEvent> &p_key_event);
 
+	// Called on the first node of a batch of nodes sharing the same class or script with process_batched enabled.
+	// Classes implementing them must also return true from _has_process_batch(), otherwise their nodes are processed one by one.
+	virtual void _process_batch(double p_delta, Span<Node *> p_nodes);
+	virtual void _physics_process_batch(double p_delta, Span<Node *> p_nodes);
+	virtual bool _has_process_batch(bool p_physics) const;
+
 	GDVIRTUAL1(_process, double)
 	GDVIRTUAL1(_physics_process, double)
+	GDVIRTUAL2(_process_batch, double, TypedArray<Node>)
+	GDVIRTUAL2(_physics_process_batch, double, TypedArray<Node>)
 	GDVIRTUAL0(_enter_tree)
 	GDVIRTUAL0(_exit_tree)
 	GDVIRTUAL0(_ready)
@@ -515,6 +561,9 @@ public:
 	void set_unique_name_in_owner(bool p_enabled);
 	bool is_unique_name_in_owner() const;
 
+	void set_cache_node_paths(bool p_enabled);
+	bool is_caching_node_paths() const;
+
 	_FORCE_INLINE_ int get_index(bool p_include_internal = true) const {
 		// p_include_internal = false doesn't make sense if the node is internal.
 		ERR_FAIL_COND_V_MSG(!p_include_internal && data.internal_mode != INTERNAL_MODE_DISABLED, -1, "Node is internal. Can't get index with 'include_internal' being false.");
@@ -569,6 +618,9 @@ public:
 	void get_storable_properties(HashSet<StringName> &r_storable_properties) const;
 
 	virtual String to_string() override;
+#ifdef DEBUG_ENABLED
+	virtual Variant callp(const StringName &p_method, const Variant **p_args, int p_argcount, Callable::CallError &r_error) override;
+#endif
 
 	/* NOTIFICATIONS */
 
@@ -592,6 +644,9 @@ public:
 	void set_process_internal(bool p_process_internal);
 	bool is_processing_internal() const;
 
+	void set_process_batched(bool p_batched);
+	bool is_process_batched() const;
+
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
@@ -642,6 +697,27 @@ public:
 
 	_FORCE_INLINE_ static bool is_group_processing() { return current_process_thread_group; }
 
+#ifdef DEBUG_ENABLED
+	// Used by the thread guards, so that automatic thread groups learn whether they can be processed in a thread.
+	_FORCE_INLINE_ bool _is_thread_guard_passed(const char *p_function) const {
+		if (unlikely(current_process_thread_group_probe != nullptr) && data.inside_tree && current_process_thread_group_probe != data.process_thread_group_owner) {
+			_report_thread_group_access(p_function, false);
+		}
+		const bool accessible = is_accessible_from_caller_thread();
+		if (unlikely(!accessible) && current_process_thread_group != nullptr) {
+			_report_thread_group_access(p_function, false);
+		}
+		return accessible;
+	}
+
+	_FORCE_INLINE_ bool _is_main_thread_guard_passed(const char *p_function) const {
+		if (unlikely(current_process_thread_group_probe != nullptr || current_process_thread_group != nullptr)) {
+			_report_thread_group_access(p_function, true);
+		}
+		return is_current_thread_safe_for_nodes();
+	}
+#endif
+
 	void set_process_thread_messages(BitField<ProcessThreadMessages> p_flags);
 	BitField<ProcessThreadMessages> get_process_thread_messages() const;
 
@@ -843,10 +919,10 @@ Error Node::rpc_id(int p_peer_id, const StringName &p_method, VarArgs... p_args)
 }
 
 #ifdef DEBUG_ENABLED
-#define ERR_THREAD_GUARD ERR_FAIL_COND_MSG(!is_accessible_from_caller_thread(), vformat("Caller thread can't call this function in this node (%s). Use call_deferred() or call_thread_group() instead.", get_description()));
-#define ERR_THREAD_GUARD_V(m_ret) ERR_FAIL_COND_V_MSG(!is_accessible_from_caller_thread(), (m_ret), vformat("Caller thread can't call this function in this node (%s). Use call_deferred() or call_thread_group() instead.", get_description()));
-#define ERR_MAIN_THREAD_GUARD ERR_FAIL_COND_MSG(is_inside_tree() && !is_current_thread_safe_for_nodes(), vformat("This function in this node (%s) can only be accessed from the main thread. Use call_deferred() instead.", get_description()));
-#define ERR_MAIN_THREAD_GUARD_V(m_ret) ERR_FAIL_COND_V_MSG(is_inside_tree() && !is_current_thread_safe_for_nodes(), (m_ret), vformat("This function in this node (%s) can only be accessed from the main thread. Use call_deferred() instead.", get_description()));
+#define ERR_THREAD_GUARD ERR_FAIL_COND_MSG(!_is_thread_guard_passed(FUNCTION_STR), vformat("Caller thread can't call this function in this node (%s). Use call_deferred() or call_thread_group() instead.", get_description()));
+#define ERR_THREAD_GUARD_V(m_ret) ERR_FAIL_COND_V_MSG(!_is_thread_guard_passed(FUNCTION_STR), (m_ret), vformat("Caller thread can't call this function in this node (%s). Use call_deferred() or call_thread_group() instead.", get_description()));
+#define ERR_MAIN_THREAD_GUARD ERR_FAIL_COND_MSG(is_inside_tree() && !_is_main_thread_guard_passed(FUNCTION_STR), vformat("This function in this node (%s) can only be accessed from the main thread. Use call_deferred() instead.", get_description()));
+#define ERR_MAIN_THREAD_GUARD_V(m_ret) ERR_FAIL_COND_V_MSG(is_inside_tree() && !_is_main_thread_guard_passed(FUNCTION_STR), (m_ret), vformat("This function in this node (%s) can only be accessed from the main thread. Use call_deferred() instead.", get_description()));
 #define ERR_READ_THREAD_GUARD ERR_FAIL_COND_MSG(!is_readable_from_caller_thread(), vformat("This function in this node (%s) can only be accessed from either the main thread or a thread group. Use call_deferred() instead.", get_description()));
 #define ERR_READ_THREAD_GUARD_V(m_ret) ERR_FAIL_COND_V_MSG(!is_readable_from_caller_thread(), (m_ret), vformat("This function in this node (%s) can only be accessed from either the main thread or a thread group. Use call_deferred() instead.", get_description()));
 #else
@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/script_instance.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "node.h"
@@ -140,6 +141,10 @@ void SceneTree::ClientPhysicsInterpolation::physics_process() {
 #endif // _3D_DISABLED
 
 void SceneTree::tree_changed() {
+	if (tree_batch_depth > 0) {
+		tree_batch_changed = true;
+		return;
+	}
 	emit_signal(tree_changed_name);
 }
 
@@ -162,6 +167,85 @@ void SceneTree::node_renamed(Node *p_node) {
 	emit_signal(node_renamed_name, p_node);
 }
 
+static void _erase_pending_nodes(Vector<Node *> &r_nodes, LocalVector<Node *> &r_pending, int *r_sorted_count = nullptr) {
+	if (r_pending.size() == 1) {
+		int index = r_nodes.find(r_pending[0]);
+		if (index >= 0) {
+			r_nodes.remove_at(index);
+			if (r_sorted_count && index < *r_sorted_count) {
+				(*r_sorted_count)--;
+			}
+		}
+	} else if (!r_pending.is_empty()) {
+		HashSet<Node *> removed;
+		removed.reserve(r_pending.size());
+		for (Node *node : r_pending) {
+			removed.insert(node);
+		}
+
+		// Compact in place, keeping the relative order so sorted lists stay sorted.
+		Node **ptr = r_nodes.ptrw();
+		int count = r_nodes.size();
+		int kept = 0;
+		int sorted_kept = 0;
+		for (int i = 0; i < count; i++) {
+			if (!removed.has(ptr[i])) {
+				if (r_sorted_count && i < *r_sorted_count) {
+					sorted_kept++;
+				}
+				ptr[kept++] = ptr[i];
+			}
+		}
+		r_nodes.resize(kept);
+		if (r_sorted_count) {
+			*r_sorted_count = sorted_kept;
+		}
+	}
+	r_pending.clear();
+}
+
+void SceneTree::_begin_tree_batch() {
+	_THREAD_SAFE_METHOD_
+	tree_batch_depth++;
+}
+
+void SceneTree::_end_tree_batch() {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND(tree_batch_depth == 0);
+	tree_batch_depth--;
+	if (tree_batch_depth > 0) {
+		return;
+	}
+
+	for (const StringName &name : tree_batch_groups) {
+		HashMap<StringName, Group>::Iterator E = group_map.find(name);
+		if (!E) {
+			continue;
+		}
+		_erase_pending_nodes(E->value.nodes, E->value.pending_removals, &E->value.sorted_count);
+		E->value.view_valid = false;
+		if (E->value.nodes.is_empty()) {
+			group_map.remove(E);
+		}
+	}
+	tree_batch_groups.clear();
+
+	for (ProcessGroup *pg : tree_batch_process_groups) {
+		_flush_process_group_removals(pg);
+	}
+	tree_batch_process_groups.clear();
+
+	if (tree_batch_changed) {
+		tree_batch_changed = false;
+		emit_signal(tree_changed_name);
+	}
+}
+
+void SceneTree::_flush_process_group_removals(ProcessGroup *p_group) {
+	_erase_pending_nodes(p_group->nodes, p_group->pending_removals);
+	_erase_pending_nodes(p_group->physics_nodes, p_group->physics_pending_removals);
+}
+
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
 	_THREAD_SAFE_METHOD_
 
@@ -170,9 +254,18 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
+	if (unlikely(!E->value.pending_removals.is_empty())) {
+		// The node may be entering again a group it's still pending removal from.
+		_erase_pending_nodes(E->value.nodes, E->value.pending_removals, &E->value.sorted_count);
+	}
+
+#ifdef DEV_ENABLED
+	// Nodes keep track of their own groups, so this is a linear search that can only fail on a bug.
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+#endif
+	// Left unsorted at the end, it's merged in tree order when the group is next used.
 	E->value.nodes.push_back(p_node);
-	E->value.changed = true;
+	E->value.view_valid = false;
 	return &E->value;
 }
 
@@ -182,7 +275,21 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
+	if (tree_batch_depth > 0) {
+		if (E->value.pending_removals.is_empty()) {
+			tree_batch_groups.push_back(p_group);
+		}
+		E->value.pending_removals.push_back(p_node);
+		return;
+	}
+
+	int index = E->value.nodes.find(p_node);
+	ERR_FAIL_COND(index < 0);
+	E->value.nodes.remove_at(index);
+	if (index < E->value.sorted_count) {
+		E->value.sorted_count--;
+	}
+	E->value.view_valid = false;
 	if (E->value.nodes.is_empty()) {
 		group_map.remove(E);
 	}
@@ -199,6 +306,11 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	// Nodes marked as having their notifications queued (see Node3D) no longer do once
+	// they are dequeued, so start a new pass before the walk and after each notification.
+	// Handlers may change transforms again, which must not skip the nodes notified so far.
+	_next_xform_change_pass();
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -206,6 +318,7 @@ void SceneTree::flush_transform_notifications() {
 		xform_change_list.remove(n);
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
+		_next_xform_change_pass();
 	}
 }
 
@@ -230,20 +343,60 @@ void SceneTree::_flush_ugc() {
 }
 
 void SceneTree::_update_group_order(Group &g) {
-	if (!g.changed) {
+	if (unlikely(!g.pending_removals.is_empty())) {
+		_erase_pending_nodes(g.nodes, g.pending_removals, &g.sorted_count);
+		g.view_valid = false;
+	}
+
+	int gr_node_count = g.nodes.size();
+	if (!g.changed && g.sorted_count == gr_node_count) {
 		return;
 	}
-	if (g.nodes.is_empty()) {
+	g.view_valid = false;
+	if (gr_node_count == 0) {
+		g.sorted_count = 0;
+		g.changed = false;
 		return;
 	}
 
 	Node **gr_nodes = g.nodes.ptrw();
-	int gr_node_count = g.nodes.size();
-
 	SortArray<Node *, Node::Comparator> node_sort;
-	node_sort.sort(gr_nodes, gr_node_count);
 
-	g.changed = false;
+	if (g.changed || g.sorted_count == 0) {
+		node_sort.sort(gr_nodes, gr_node_count);
+		g.sorted_count = gr_node_count;
+		g.changed = false;
+		return;
+	}
+
+	// Only nodes added since the last update need sorting, then they are merged into the sorted ones.
+	// Working from the back, each added node is placed with a binary search, so a few nodes added
+	// to a large group only need a few comparisons and moving the nodes after them once.
+	Node::Comparator compare;
+	int added_count = gr_node_count - g.sorted_count;
+	LocalVector<Node *> added;
+	added.resize(added_count);
+	memcpy(added.ptr(), gr_nodes + g.sorted_count, added_count * sizeof(Node *));
+	node_sort.sort(added.ptr(), added_count);
+
+	int limit = g.sorted_count;
+	for (int i = added_count - 1; i >= 0; i--) {
+		Node *node = added[i];
+		int low = 0;
+		int high = limit;
+		while (low < high) {
+			int middle = (low + high) / 2;
+			if (compare(node, gr_nodes[middle])) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
+		}
+		memmove(gr_nodes + low + i + 1, gr_nodes + low, (limit - low) * sizeof(Node *));
+		gr_nodes[low + i] = node;
+		limit = low;
+	}
+	g.sorted_count = gr_node_count;
 }
 
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
@@ -1026,6 +1179,10 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 
 	p_group->call_queue.flush(); // Flush messages before processing.
 
+	if (unlikely(!p_group->pending_removals.is_empty() || !p_group->physics_pending_removals.is_empty())) {
+		_flush_process_group_removals(p_group);
+	}
+
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
 	if (nodes.is_empty()) {
 		return;
@@ -1049,8 +1206,20 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	uint32_t node_count = nodes_copy.size();
 	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
 
+	const int32_t *node_batches = nullptr;
+	if ((p_physics ? p_group->physics_batched_node_count : p_group->batched_node_count) > 0) {
+		_gather_process_batches(p_group, nodes_ptr, node_count, p_physics);
+		node_batches = p_group->node_batches.ptr();
+	}
+
 	for (uint32_t i = 0; i < node_count; i++) {
 		Node *n = nodes_ptr[i];
+		const int32_t batch = node_batches ? node_batches[i] : -1;
+		if (batch >= 0 && p_group->batches[batch].first == i) {
+			// The whole batch is processed where its first node would have been.
+			_process_batch(p_group->batches[batch], p_physics);
+		}
+
 		if (nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
@@ -1065,14 +1234,14 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			if (n->is_physics_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
 			}
-			if (n->is_physics_processing()) {
+			if (batch < 0 && n->is_physics_processing()) {
 				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
 			}
 		} else {
 			if (n->is_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
 			}
-			if (n->is_processing()) {
+			if (batch < 0 && n->is_processing()) {
 				n->notification(Node::NOTIFICATION_PROCESS);
 			}
 		}
@@ -1081,6 +1250,74 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
+void SceneTree::_gather_process_batches(ProcessGroup *p_group, Node *const *p_nodes, uint32_t p_node_count, bool p_physics) {
+	// Process lists are sorted by priority, so batches only need to be looked up among nodes of the same priority.
+	p_group->node_batches.resize(p_node_count);
+	p_group->batch_count = 0;
+	p_group->batch_indices.clear();
+	int priority = 0;
+
+	for (uint32_t i = 0; i < p_node_count; i++) {
+		Node *n = p_nodes[i];
+		p_group->node_batches[i] = -1;
+		if (!n->data.process_batched || !(p_physics ? n->data.physics_process : n->data.process)) {
+			continue;
+		}
+		if (!n->_has_process_batch(p_physics)) {
+			// Processed one by one, in their place in the processing order.
+			continue;
+		}
+
+		const int node_priority = p_physics ? n->data.physics_process_priority : n->data.process_priority;
+		if (node_priority != priority) {
+			p_group->batch_indices.clear();
+			priority = node_priority;
+		}
+
+		const ScriptInstance *si = n->get_script_instance();
+		const void *key = si ? (const void *)si->get_script().ptr() : n->get_class_name().data_unique_pointer();
+
+		uint32_t *index = p_group->batch_indices.getptr(key);
+		if (!index) {
+			if (p_group->batch_count == p_group->batches.size()) {
+				p_group->batches.push_back(ProcessBatch());
+			}
+			ProcessBatch &batch = p_group->batches[p_group->batch_count];
+			batch.first = i;
+			batch.nodes.clear();
+			index = &p_group->batch_indices.insert(key, p_group->batch_count)->value;
+			p_group->batch_count++;
+		}
+
+		p_group->batches[*index].nodes.push_back(n);
+		p_group->node_batches[i] = *index;
+	}
+}
+
+void SceneTree::_process_batch(ProcessBatch &p_batch, bool p_physics) {
+	// Earlier nodes may have changed the state of the ones in the batch, so check them again.
+	uint32_t count = 0;
+	for (Node *n : p_batch.nodes) {
+		if (nodes_removed_on_group_call.has(n) || !n->can_process() || !n->is_inside_tree() || !n->data.process_batched) {
+			continue;
+		}
+		if (!(p_physics ? n->data.physics_process : n->data.process)) {
+			continue;
+		}
+		p_batch.nodes[count++] = n;
+	}
+	if (count == 0) {
+		return;
+	}
+
+	Node *first = p_batch.nodes[0];
+	if (p_physics) {
+		first->_physics_process_batch(physics_process_time, Span<Node *>(p_batch.nodes.ptr(), count));
+	} else {
+		first->_process_batch(process_time, Span<Node *>(p_batch.nodes.ptr(), count));
+	}
+}
+
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
 	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
 	_process_group(local_process_group_cache[p_index], p_physics);
@@ -1131,16 +1368,16 @@ void SceneTree::_process(bool p_physics) {
 	nodes_removed_on_group_call_lock++;
 
 	int current_order = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group_order : 0;
-	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+	bool current_threaded = process_groups[0]->threaded;
 
 	for (uint32_t i = 0; i <= group_count; i++) {
 		int order = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group_order : 0;
-		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+		bool threaded = i < group_count && process_groups[i]->threaded;
 
 		if (i == group_count || current_order != order || current_threaded != threaded) {
 			if (process_count > 0) {
 				// Proceed to process the group.
-				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+				bool using_threads = process_groups[from]->threaded && !node_threading_disabled;
 
 				if (using_threads) {
 					local_process_group_cache.clear();
@@ -1149,6 +1386,13 @@ void SceneTree::_process(bool p_physics) {
 					if (process_groups[j]->last_pass == process_last_pass) {
 						if (using_threads) {
 							local_process_group_cache.push_back(process_groups[j]);
+#ifdef DEBUG_ENABLED
+						} else if (process_groups[j]->automatic_state == AUTOMATIC_THREAD_CHECKING) {
+							Node::current_process_thread_group_probe = process_groups[j]->owner;
+							_process_group(process_groups[j], p_physics);
+							Node::current_process_thread_group_probe = nullptr;
+							process_groups[j]->checked_this_frame = true;
+#endif
 						} else {
 							_process_group(process_groups[j], p_physics);
 						}
@@ -1203,6 +1447,69 @@ void SceneTree::_process(bool p_physics) {
 	if (nodes_removed_on_group_call_lock == 0) {
 		nodes_removed_on_group_call.clear();
 	}
+
+	if (automatic_process_group_count > 0) {
+		_update_automatic_process_groups(p_physics);
+	}
+}
+
+void SceneTree::_report_thread_group_access(Node *p_owner, const Node *p_node, const char *p_function, bool p_main_thread_only) {
+	// Called from the thread processing the group, only the first access is kept.
+	ProcessGroup *pg = (ProcessGroup *)p_owner->data.process_group;
+	if (!pg || pg->access_reported || pg->automatic_state == AUTOMATIC_THREAD_MAIN_THREAD) {
+		return;
+	}
+
+	if (p_main_thread_only) {
+		pg->main_thread_reason = vformat("%s() was called on %s, which can only be done from the main thread.", p_function, p_node->get_description());
+	} else {
+		pg->main_thread_reason = vformat("%s() was called on %s, which is outside of the thread group.", p_function, p_node->get_description());
+	}
+	pg->access_reported = true;
+}
+
+void SceneTree::_update_automatic_process_groups(bool p_physics) {
+	for (ProcessGroup *pg : process_groups) {
+		if (pg->removed || pg->automatic_state == AUTOMATIC_THREAD_NONE || pg->automatic_state == AUTOMATIC_THREAD_MAIN_THREAD) {
+			continue;
+		}
+
+		if (pg->access_reported) {
+			pg->automatic_state = AUTOMATIC_THREAD_MAIN_THREAD;
+			if (pg->threaded) {
+				pg->threaded = false;
+				process_groups_dirty = true;
+			}
+			WARN_PRINT(vformat("The automatic process thread group of %s will be processed on the main thread: %s", pg->owner->get_description(), pg->main_thread_reason));
+		} else if (!p_physics && pg->automatic_state == AUTOMATIC_THREAD_CHECKING && pg->checked_this_frame) {
+			// Count frames rather than passes, the physics pass may run any number of times per frame.
+			pg->checked_this_frame = false;
+			pg->checked_frames_left--;
+			if (pg->checked_frames_left == 0) {
+				pg->automatic_state = AUTOMATIC_THREAD_SUB_THREAD;
+				pg->threaded = true;
+				process_groups_dirty = true;
+				print_verbose(vformat("The automatic process thread group of %s will be processed on a sub-thread.", pg->owner->get_description()));
+			}
+		}
+	}
+}
+
+TypedArray<Dictionary> SceneTree::get_automatic_thread_groups() const {
+	TypedArray<Dictionary> ret;
+	for (const ProcessGroup *pg : process_groups) {
+		if (pg->removed || pg->automatic_state == AUTOMATIC_THREAD_NONE) {
+			continue;
+		}
+
+		Dictionary group;
+		group["node"] = pg->owner;
+		group["threaded"] = pg->automatic_state == AUTOMATIC_THREAD_SUB_THREAD;
+		group["checking"] = pg->automatic_state == AUTOMATIC_THREAD_CHECKING;
+		group["reason"] = pg->main_thread_reason;
+		ret.push_back(group);
+	}
+	return ret;
 }
 
 bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
@@ -1210,8 +1517,8 @@ bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const P
 	int right_order = p_right->owner ? p_right->owner->data.process_thread_group_order : 0;
 
 	if (left_order == right_order) {
-		int left_threaded = p_left->owner != nullptr && p_left->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
-		int right_threaded = p_right->owner != nullptr && p_right->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
+		int left_threaded = p_left->threaded ? 0 : 1;
+		int right_threaded = p_right->threaded ? 0 : 1;
 		return left_threaded < right_threaded;
 	} else {
 		return left_order < right_order;
@@ -1223,6 +1530,9 @@ void SceneTree::_remove_process_group(Node *p_node) {
 	ProcessGroup *pg = (ProcessGroup *)p_node->data.process_group;
 	ERR_FAIL_NULL(pg);
 	ERR_FAIL_COND(pg->removed);
+	if (pg->automatic_state != AUTOMATIC_THREAD_NONE) {
+		automatic_process_group_count--;
+	}
 	pg->removed = true;
 	pg->owner = nullptr;
 	p_node->data.process_group = nullptr;
@@ -1238,6 +1548,20 @@ void SceneTree::_add_process_group(Node *p_node) {
 	pg->owner = p_node;
 	p_node->data.process_group = pg;
 
+	if (p_node->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD) {
+		pg->threaded = true;
+	} else if (p_node->data.process_thread_group == Node::PROCESS_THREAD_GROUP_AUTOMATIC) {
+		automatic_process_group_count++;
+#ifdef DEBUG_ENABLED
+		pg->automatic_state = AUTOMATIC_THREAD_CHECKING;
+		pg->checked_frames_left = AUTOMATIC_THREAD_GROUP_CHECK_FRAMES;
+#else
+		// The thread guards are not compiled in, so there is no way to tell whether it's safe.
+		pg->automatic_state = AUTOMATIC_THREAD_MAIN_THREAD;
+		pg->main_thread_reason = "Thread safety can only be checked in debug builds.";
+#endif
+	}
+
 	process_groups.push_back(pg);
 
 	process_groups_dirty = true;
@@ -1247,14 +1571,32 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	if (tree_batch_depth > 0) {
+		bool was_pending = !pg->pending_removals.is_empty() || !pg->physics_pending_removals.is_empty();
+		if (p_node->is_processing() || p_node->is_processing_internal()) {
+			pg->pending_removals.push_back(p_node);
+			pg->batched_node_count -= p_node->data.process_batched;
+		}
+		if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+			pg->physics_pending_removals.push_back(p_node);
+			pg->physics_batched_node_count -= p_node->data.process_batched;
+		}
+		if (!was_pending) {
+			tree_batch_process_groups.push_back(pg);
+		}
+		return;
+	}
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
 		bool found = pg->nodes.erase(p_node);
 		ERR_FAIL_COND(!found);
+		pg->batched_node_count -= p_node->data.process_batched;
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
 		bool found = pg->physics_nodes.erase(p_node);
 		ERR_FAIL_COND(!found);
+		pg->physics_batched_node_count -= p_node->data.process_batched;
 	}
 }
 
@@ -1262,14 +1604,21 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	if (unlikely(!pg->pending_removals.is_empty() || !pg->physics_pending_removals.is_empty())) {
+		// The node may be entering again a process list it's still pending removal from.
+		_flush_process_group_removals(pg);
+	}
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
 		pg->nodes.push_back(p_node);
 		pg->node_order_dirty = true;
+		pg->batched_node_count += p_node->data.process_batched;
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
 		pg->physics_nodes.push_back(p_node);
 		pg->physics_node_order_dirty = true;
+		pg->physics_batched_node_count += p_node->data.process_batched;
 	}
 }
 
@@ -1424,7 +1773,9 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 
 bool SceneTree::has_group(const StringName &p_identifier) const {
 	_THREAD_SAFE_METHOD_
-	return group_map.has(p_identifier);
+	HashMap<StringName, Group>::ConstIterator E = group_map.find(p_identifier);
+	// Groups are only erased once their pending removals are applied.
+	return E && E->value.nodes.size() > (int)E->value.pending_removals.size();
 }
 
 int SceneTree::get_node_count_in_group(const StringName &p_group) const {
@@ -1434,7 +1785,7 @@ int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 		return 0;
 	}
 
-	return E->value.nodes.size();
+	return E->value.nodes.size() - E->value.pending_removals.size();
 }
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
@@ -1453,6 +1804,44 @@ Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 	return E->value.nodes[0];
 }
 
+Vector<Node *> SceneTree::get_nodes_in_group(const StringName &p_group) {
+	_THREAD_SAFE_METHOD_
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	if (!E) {
+		return Vector<Node *>();
+	}
+
+	_update_group_order(E->value);
+	return E->value.nodes;
+}
+
+TypedArray<Node> SceneTree::get_nodes_in_group_view(const StringName &p_group) {
+	_THREAD_SAFE_METHOD_
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	if (!E) {
+		TypedArray<Node> ret;
+		ret.make_read_only();
+		return ret;
+	}
+
+	Group &g = E->value;
+	_update_group_order(g);
+	if (!g.view_valid) {
+		// Scripts may still hold the previous view, so it can't be reused.
+		TypedArray<Node> view;
+		int nc = g.nodes.size();
+		view.resize(nc);
+		const Node *const *ptr = g.nodes.ptr();
+		for (int i = 0; i < nc; i++) {
+			view[i] = ptr[i];
+		}
+		view.make_read_only();
+		g.view = view;
+		g.view_valid = true;
+	}
+	return g.view;
+}
+
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
 	_THREAD_SAFE_METHOD_
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
@@ -1785,8 +2174,10 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_group", "group", "property", "value"), &SceneTree::set_group);
 
 	ClassDB::bind_method(D_METHOD("get_nodes_in_group", "group"), &SceneTree::_get_nodes_in_group);
+	ClassDB::bind_method(D_METHOD("get_nodes_in_group_view", "group"), &SceneTree::get_nodes_in_group_view);
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
 	ClassDB::bind_method(D_METHOD("get_node_count_in_group", "group"), &SceneTree::get_node_count_in_group);
+	ClassDB::bind_method(D_METHOD("get_automatic_thread_groups"), &SceneTree::get_automatic_thread_groups);
 
 	ClassDB::bind_method(D_METHOD("set_current_scene", "child_node"), &SceneTree::set_current_scene);
 	ClassDB::bind_method(D_METHOD("get_current_scene"), &SceneTree::get_current_scene);
@@ -91,15 +91,47 @@ public:
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
 
+	// Nodes with Node::process_batched of the same class or script and priority, processed with a single call.
+	struct ProcessBatch {
+		uint32_t first = 0; // Index of the first node in the process list.
+		LocalVector<Node *> nodes;
+	};
+
+	// Automatic thread groups (Node::PROCESS_THREAD_GROUP_AUTOMATIC) are first processed on the main thread while the
+	// thread guards check that their nodes don't access anything outside the group, and then moved to a thread.
+	enum AutomaticThreadState {
+		AUTOMATIC_THREAD_NONE,
+		AUTOMATIC_THREAD_CHECKING,
+		AUTOMATIC_THREAD_SUB_THREAD,
+		AUTOMATIC_THREAD_MAIN_THREAD,
+	};
+
 	struct ProcessGroup {
 		CallQueue call_queue;
 		Vector<Node *> nodes;
 		Vector<Node *> physics_nodes;
+		LocalVector<Node *> pending_removals;
+		LocalVector<Node *> physics_pending_removals;
+		uint32_t batched_node_count = 0;
+		uint32_t physics_batched_node_count = 0;
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		bool threaded = false;
+
+		AutomaticThreadState automatic_state = AUTOMATIC_THREAD_NONE;
+		uint32_t checked_frames_left = 0;
+		bool checked_this_frame = false; // Processed while checking, in either the physics or the idle pass.
+		bool access_reported = false; // Only written by the thread processing the group.
+		String main_thread_reason;
+
+		// Scratch space for processing batched nodes, kept to avoid allocating every frame.
+		LocalVector<int32_t> node_batches;
+		LocalVector<ProcessBatch> batches;
+		uint32_t batch_count = 0;
+		HashMap<const void *, uint32_t> batch_indices;
 	};
 
 	struct ProcessGroupSort {
@@ -119,9 +151,20 @@ private:
 
 	struct Group {
 		Vector<Node *> nodes;
-		bool changed = false;
+		LocalVector<Node *> pending_removals;
+		int sorted_count = 0; // Nodes are added at the end, only the ones before are known to be in tree order.
+		bool changed = false; // The tree order of nodes in the group changed, they all need to be sorted again.
+		bool view_valid = false;
+		Array view; // Read-only, see get_nodes_in_group_view().
 	};
 
+	// While a subtree enters or exits the tree, removals from groups and process lists are
+	// recorded and applied in bulk when the outermost batch ends, instead of one at a time.
+	int tree_batch_depth = 0;
+	bool tree_batch_changed = false;
+	LocalVector<StringName> tree_batch_groups;
+	LocalVector<ProcessGroup *> tree_batch_process_groups;
+
 #ifndef _3D_DISABLED
 	struct ClientPhysicsInterpolation {
 		SelfList<Node3D>::List _node_3d_list;
@@ -225,11 +268,20 @@ private:
 	void make_group_changed(const StringName &p_group);
 
 	void _process_group(ProcessGroup *p_group, bool p_physics);
+	void _gather_process_batches(ProcessGroup *p_group, Node *const *p_nodes, uint32_t p_node_count, bool p_physics);
+	void _process_batch(ProcessBatch &p_batch, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
 
+	void _begin_tree_batch();
+	void _end_tree_batch();
+	void _flush_process_group_removals(ProcessGroup *p_group);
+
 	void _remove_process_group(Node *p_node);
 	void _add_process_group(Node *p_node);
+	void _report_thread_group_access(Node *p_owner, const Node *p_node, const char *p_function, bool p_main_thread_only);
+	void _update_automatic_process_groups(bool p_physics);
+	uint32_t automatic_process_group_count = 0;
 	void _remove_node_from_process_group(Node *p_node, Node *p_owner);
 	void _add_node_to_process_group(Node *p_node, Node *p_owner);
 
@@ -243,6 +295,13 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	uint32_t xform_change_pass = 1; // Incremented while flushing xform_change_list, never 0.
+	_FORCE_INLINE_ void _next_xform_change_pass() {
+		xform_change_pass++;
+		if (unlikely(xform_change_pass == 0)) {
+			xform_change_pass = 1;
+		}
+	}
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -391,10 +450,16 @@ public:
 	void queue_delete(Object *p_object);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
+	// Doesn't allocate, the returned vector is copy-on-write so it stays valid if the group changes while iterating it.
+	Vector<Node *> get_nodes_in_group(const StringName &p_group);
+	TypedArray<Node> get_nodes_in_group_view(const StringName &p_group);
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
 	int get_node_count_in_group(const StringName &p_group) const;
 
+	static constexpr uint32_t AUTOMATIC_THREAD_GROUP_CHECK_FRAMES = 60;
+	TypedArray<Dictionary> get_automatic_thread_groups() const;
+
 	//void change_scene(const String& p_path);
 	//Node *get_loaded_scene();
 
@@ -33,6 +33,7 @@
 #include "core/config/engine.h"
 #include "core/io/missing_resource.h"
 #include "core/io/resource_loader.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "scene/2d/node_2d.h"
 #ifndef _3D_DISABLED
@@ -41,6 +42,7 @@
 #include "scene/gui/control.h"
 #include "scene/main/instance_placeholder.h"
 #include "scene/main/missing_node.h"
+#include "scene/main/scene_tree.h"
 #include "scene/property_utils.h"
 
 #define PACKED_SCENE_VERSION 3
@@ -123,6 +125,93 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+void SceneState::_compile_instantiation_plan() const {
+	InstantiationPlan &plan = instantiation_plan;
+	const int node_count = nodes.size();
+	const int name_count = names.size();
+
+	plan.setters.clear();
+	plan.node_setter_offsets.resize(node_count);
+	plan.node_child_counts.resize(node_count);
+	for (uint32_t &count : plan.node_child_counts) {
+		count = 0;
+	}
+
+	for (int i = 0; i < node_count; i++) {
+		const NodeData &n = nodes[i];
+		plan.node_setter_offsets[i] = plan.setters.size();
+
+		if (n.parent >= 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent < node_count) {
+			plan.node_child_counts[n.parent]++;
+		}
+
+		// Only setters of nodes created from a native class can be resolved in advance,
+		// other nodes may come with a script or an extension intercepting properties.
+		StringName class_name;
+		if (n.type != TYPE_INSTANTIATED && n.instance < 0 && !(i == 0 && base_scene_idx >= 0) && n.type >= 0 && n.type < name_count) {
+			const ClassDB::APIType api = ClassDB::get_api_type(names[n.type]);
+			if (api == ClassDB::API_CORE || api == ClassDB::API_EDITOR) {
+				class_name = names[n.type];
+			}
+		}
+
+		for (const NodeData::Property &prop : n.properties) {
+			InstantiationPlan::PropertySetter setter;
+			if (class_name != StringName() && !(prop.name & FLAG_PATH_PROPERTY_IS_NODE) && prop.name >= 0 && prop.name < name_count && names[prop.name] != CoreStringName(script)) {
+				const StringName setter_name = ClassDB::get_property_setter(class_name, names[prop.name]);
+				MethodBind *method = setter_name != StringName() ? ClassDB::get_method(class_name, setter_name) : nullptr;
+				if (method) {
+					const int index = ClassDB::get_property_index(class_name, names[prop.name]);
+					const int argc = index >= 0 ? 2 : 1;
+					setter.method = method;
+					if (index >= 0) {
+						setter.index = index;
+					}
+
+					if (!method->is_vararg() && method->get_argument_count() == argc && (index < 0 || method->get_argument_type(0) == Variant::INT)) {
+						// Objects and containers may need to be checked or converted against the argument type.
+						const Variant::Type type = method->get_argument_type(argc - 1);
+						if (type != Variant::NIL && type != Variant::OBJECT && type != Variant::ARRAY && type != Variant::DICTIONARY) {
+							setter.validated_type = type;
+						}
+					}
+				}
+			}
+			plan.setters.push_back(setter);
+		}
+	}
+
+	plan.connection_binds.resize(connections.size());
+	for (int i = 0; i < connections.size(); i++) {
+		const ConnectionData &c = connections[i];
+		Vector<Variant> &binds = plan.connection_binds[i];
+		binds.clear();
+		for (int j = 0; j < c.binds.size(); j++) {
+			ERR_CONTINUE(c.binds[j] < 0 || c.binds[j] >= variants.size());
+			binds.push_back(variants[c.binds[j]]);
+		}
+	}
+}
+
+void SceneState::_set_property_from_plan(Node *p_node, const InstantiationPlan::PropertySetter &p_setter, const Variant &p_value, bool &r_valid) {
+	const Variant *args[2];
+	int argc = 0;
+	if (p_setter.index.get_type() != Variant::NIL) {
+		args[argc++] = &p_setter.index;
+	}
+	args[argc++] = &p_value;
+
+	if (p_setter.validated_type != Variant::NIL && p_value.get_type() == p_setter.validated_type) {
+		Variant ret;
+		p_setter.method->validated_call(p_node, args, &ret);
+		r_valid = true;
+	} else {
+		Callable::CallError ce;
+		p_setter.method->call(p_node, args, argc, ce);
+		r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -152,7 +241,16 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		props = &variants[0];
 	}
 
-	//Vector<Variant> properties;
+	if (!instantiation_plan_compiled.is_set()) {
+		MutexLock lock(instantiation_plan_mutex);
+		if (!instantiation_plan_compiled.is_set()) {
+			_compile_instantiation_plan();
+			instantiation_plan_compiled.set();
+		}
+	}
+	const InstantiationPlan &plan = instantiation_plan;
+	// Setters are called directly only at runtime, the editor relies on Object::set() to track edits.
+	const bool use_planned_setters = p_edit_state == GEN_EDIT_STATE_DISABLED;
 
 	const NodeData *nd = &nodes[0];
 
@@ -190,6 +288,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
 		bool is_inherited_scene = false;
+		bool is_planned_class = false;
 
 		if (i == 0 && base_scene_idx >= 0) {
 			// Scene inheritance on root node.
@@ -259,6 +358,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			Object *obj = ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
+			is_planned_class = node != nullptr;
 
 			if (!node) {
 				if (obj) {
@@ -299,10 +399,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			// may not have found the node (part of instantiated scene and removed)
 			// if found all is good, otherwise ignore
 
+			if (plan.node_child_counts[i] > 0) {
+				node->data.children.reserve(node->data.children.size() + plan.node_child_counts[i]);
+			}
+
 			//properties
 			int nprop_count = n.properties.size();
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
+				const InstantiationPlan::PropertySetter *nsetters = is_planned_class && use_planned_setters ? &plan.setters[plan.node_setter_offsets[i]] : nullptr;
 
 				Dictionary missing_resource_properties;
 				HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_sub_scene; // Record the mappings in the sub-scene.
@@ -410,7 +515,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (nsetters && nsetters[j].method && !node->get_script_instance()) {
+								_set_property_from_plan(node, nsetters[j], value, valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -431,6 +540,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			//name
 
 			//groups
+			if (n.groups.size()) {
+				node->data.grouped.reserve(node->data.grouped.size() + n.groups.size());
+			}
 			for (int j = 0; j < n.groups.size(); j++) {
 				ERR_FAIL_INDEX_V(n.groups[j], sname_count, nullptr);
 				node->add_to_group(snames[n.groups[j]], true);
@@ -592,13 +704,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		if (c.unbinds > 0) {
 			callable = callable.unbind(c.unbinds);
 		} else if (!c.binds.is_empty()) {
-			Vector<Variant> binds;
-			if (c.binds.size()) {
-				binds.resize(c.binds.size());
-				for (int j = 0; j < c.binds.size(); j++) {
-					binds.write[j] = props[c.binds[j]];
-				}
-			}
+			const Vector<Variant> &binds = plan.connection_binds[i];
 
 			const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * binds.size());
 			for (int j = 0; j < binds.size(); j++) {
@@ -1306,6 +1412,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_invalidate_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1497,6 +1604,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_invalidate_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1980,6 +2089,7 @@ int SceneState::add_node_path(const NodePath &p_path) {
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_invalidate_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -1997,6 +2107,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
+	_invalidate_instantiation_plan();
 
 	NodeData::Property prop;
 	prop.name = p_name;
@@ -2015,12 +2126,14 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_invalidate_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
 	ERR_FAIL_INDEX(p_signal, names.size());
 	ERR_FAIL_INDEX(p_method, names.size());
+	_invalidate_instantiation_plan();
 
 	for (int i = 0; i < p_binds.size(); i++) {
 		ERR_FAIL_INDEX(p_binds[i], variants.size());
@@ -2140,6 +2253,7 @@ Error PackedScene::pack(Node *p_scene) {
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -2192,7 +2306,319 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+static void _collect_pool_nodes(Node *p_node, LocalVector<Node *> &r_nodes) {
+	r_nodes.push_back(p_node);
+	for (int i = 0; i < p_node->get_child_count(false); i++) {
+		_collect_pool_nodes(p_node->get_child(i, false), r_nodes);
+	}
+}
+
+static bool _is_node_outside_instance(Node *p_root, Object *p_object) {
+	Node *node = Object::cast_to<Node>(p_object);
+	return node && node != p_root && !p_root->is_ancestor_of(node);
+}
+
+static Ref<Resource> _duplicate_pool_resource(const Ref<Resource> &p_resource, Node *p_for_scene, HashMap<Ref<Resource>, Ref<Resource>> &r_remap_cache) {
+	HashMap<Ref<Resource>, Ref<Resource>>::Iterator E = r_remap_cache.find(p_resource);
+	if (E) {
+		return E->value;
+	}
+	Ref<Resource> local_dupe = p_resource->duplicate_for_local_scene(p_for_scene, r_remap_cache);
+	r_remap_cache[p_resource] = local_dupe;
+	return local_dupe;
+}
+
+void PackedScene::_build_pool_snapshot(Node *p_instance, LocalVector<PoolNodeSnapshot> &r_snapshot) {
+	LocalVector<Node *> nodes;
+	_collect_pool_nodes(p_instance, nodes);
+
+	HashMap<Ref<Resource>, Ref<Resource>> local_resources;
+	r_snapshot.resize(nodes.size());
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		Node *node = nodes[i];
+		PoolNodeSnapshot &snapshot = r_snapshot[i];
+		snapshot.path = p_instance->get_path_to(node);
+		snapshot.class_name = node->get_class_name();
+		snapshot.child_count = node->get_child_count(false);
+		snapshot.properties.clear();
+
+		List<PropertyInfo> properties;
+		node->get_property_list(&properties);
+		for (const PropertyInfo &E : properties) {
+			if (!(E.usage & (PROPERTY_USAGE_STORAGE | PROPERTY_USAGE_SCRIPT_VARIABLE))) {
+				continue;
+			}
+
+			PoolProperty property;
+			property.name = E.name;
+			property.value = node->get(E.name);
+
+			Object *object = property.value.get_validated_object();
+			if (object) {
+				Node *value_node = Object::cast_to<Node>(object);
+				Resource *resource = Object::cast_to<Resource>(object);
+				if (value_node) {
+					if (_is_node_outside_instance(p_instance, value_node)) {
+						// Only nodes of the instance can be found again when it is reused.
+						continue;
+					}
+					property.kind = PoolProperty::KIND_NODE;
+					property.node_path = p_instance->get_path_to(value_node);
+					property.value = Variant();
+				} else if (resource && resource->is_local_to_scene()) {
+					// Keep a copy of our own, the one of the instance may be modified while it is in use.
+					property.kind = PoolProperty::KIND_LOCAL_RESOURCE;
+					property.value = _duplicate_pool_resource(Ref<Resource>(resource), nullptr, local_resources);
+				} else if (!resource || (!(E.usage & PROPERTY_USAGE_STORAGE) && resource->get_path().is_empty())) {
+					// Objects created by scripts belong to the instance that created them.
+					continue;
+				}
+			} else if (property.value.get_type() == Variant::ARRAY || property.value.get_type() == Variant::DICTIONARY) {
+				property.kind = PoolProperty::KIND_CONTAINER;
+				property.value = property.value.duplicate(true);
+			}
+
+			snapshot.properties.push_back(property);
+		}
+	}
+}
+
+bool PackedScene::_reset_pooled_instance(Node *p_instance) const {
+	LocalVector<Node *> nodes;
+	nodes.resize(pool_snapshot.size());
+	for (uint32_t i = 0; i < pool_snapshot.size(); i++) {
+		const PoolNodeSnapshot &snapshot = pool_snapshot[i];
+		Node *node = p_instance->get_node_or_null(snapshot.path);
+		if (!node || node->get_class_name() != snapshot.class_name || node->get_child_count(false) != snapshot.child_count) {
+			// Nodes were added, removed or replaced, the instance can't be reused.
+			return false;
+		}
+		nodes[i] = node;
+	}
+
+	HashMap<Ref<Resource>, Ref<Resource>> local_resources;
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		Node *node = nodes[i];
+
+		// Drop the connections made to or from nodes outside of the instance while it was in use.
+		List<Object::Connection> connections;
+		node->get_all_signal_connections(&connections);
+		for (const Object::Connection &E : connections) {
+			if (!(E.flags & Object::CONNECT_PERSIST) && _is_node_outside_instance(p_instance, E.callable.get_object())) {
+				node->disconnect(E.signal.get_name(), E.callable);
+			}
+		}
+		connections.clear();
+		node->get_signals_connected_to_this(&connections);
+		for (const Object::Connection &E : connections) {
+			Object *source = E.signal.get_object();
+			if (!(E.flags & Object::CONNECT_PERSIST) && _is_node_outside_instance(p_instance, source)) {
+				source->disconnect(E.signal.get_name(), E.callable);
+			}
+		}
+
+		for (const PoolProperty &property : pool_snapshot[i].properties) {
+			bool valid = false;
+			switch (property.kind) {
+				case PoolProperty::KIND_VALUE: {
+					const Variant current = node->get(property.name, &valid);
+					if (!valid || current != property.value) {
+						node->set(property.name, property.value);
+					}
+				} break;
+				case PoolProperty::KIND_CONTAINER: {
+					const Variant current = node->get(property.name, &valid);
+					if (!valid || current != property.value) {
+						node->set(property.name, property.value.duplicate(true));
+					}
+				} break;
+				case PoolProperty::KIND_NODE: {
+					Node *target = p_instance->get_node_or_null(property.node_path);
+					const Variant current = node->get(property.name, &valid);
+					if (!valid || current.get_validated_object() != target) {
+						node->set(property.name, target);
+					}
+				} break;
+				case PoolProperty::KIND_LOCAL_RESOURCE: {
+					// There is no telling whether the resource was modified, always give the instance a new copy.
+					node->set(property.name, _duplicate_pool_resource(property.value, p_instance, local_resources));
+				} break;
+			}
+		}
+
+		node->request_ready();
+	}
+
+	for (KeyValue<Ref<Resource>, Ref<Resource>> &E : local_resources) {
+		if (E.value->get_local_scene() == p_instance) {
+			E.value->setup_local_to_scene();
+		}
+	}
+
+	return true;
+}
+
+void PackedScene::_prewarm_instance(uint32_t p_index, Node **p_instances) {
+	p_instances[p_index] = instantiate();
+}
+
+void PackedScene::_discard_instance(Node *p_instance) {
+	// The instance may be releasing itself from one of its own callbacks.
+	if (SceneTree::get_singleton()) {
+		p_instance->queue_free();
+	} else {
+		memdelete(p_instance);
+	}
+}
+
+void PackedScene::_store_pool_snapshot(Node *p_instance) {
+	{
+		MutexLock lock(pool_mutex);
+		if (!pool_snapshot.is_empty()) {
+			return;
+		}
+	}
+
+	// Built without holding the lock, reading every property of a large instance takes a while.
+	LocalVector<PoolNodeSnapshot> snapshot;
+	_build_pool_snapshot(p_instance, snapshot);
+
+	MutexLock lock(pool_mutex);
+	if (pool_snapshot.is_empty()) {
+		pool_snapshot = std::move(snapshot);
+	}
+}
+
+void PackedScene::_add_to_pool(Node *p_instance) {
+	MutexLock lock(pool_mutex);
+	if ((int)pool.size() < pool_max_size) {
+		pool.push_back(p_instance);
+	} else {
+		memdelete(p_instance);
+	}
+}
+
+Node *PackedScene::instantiate_pooled() {
+	{
+		MutexLock lock(pool_mutex);
+		if (!pool.is_empty()) {
+			Node *instance = pool[pool.size() - 1];
+			pool.remove_at(pool.size() - 1);
+			return instance;
+		}
+	}
+
+	Node *instance = instantiate();
+	ERR_FAIL_NULL_V(instance, nullptr);
+	_store_pool_snapshot(instance);
+	return instance;
+}
+
+void PackedScene::release_instance(Node *p_instance) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_COND_MSG(!is_built_in() && p_instance->get_scene_file_path() != get_path(), vformat("Node \"%s\" was not instantiated from this scene.", p_instance->get_name()));
+
+	Node *parent = p_instance->get_parent();
+	if (parent) {
+		parent->remove_child(p_instance);
+	}
+
+	bool has_snapshot = false;
+	{
+		MutexLock lock(pool_mutex);
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(pool.has(p_instance), vformat("Node \"%s\" was already released to the pool.", p_instance->get_name()));
+#endif
+		has_snapshot = !pool_snapshot.is_empty();
+	}
+
+	if (!has_snapshot) {
+		// The instance may already have been modified, take the snapshot from a fresh one.
+		// Instantiating can run scripts that use the pool, so it is done without the lock.
+		Node *reference = instantiate();
+		ERR_FAIL_NULL(reference);
+		_store_pool_snapshot(reference);
+		_add_to_pool(reference);
+	}
+
+	MutexLock lock(pool_mutex);
+	if ((int)pool.size() >= pool_max_size || !_reset_pooled_instance(p_instance)) {
+		_discard_instance(p_instance);
+		return;
+	}
+	pool.push_back(p_instance);
+}
+
+void PackedScene::prewarm(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+
+	int count = 0;
+	bool has_snapshot = false;
+	{
+		MutexLock lock(pool_mutex);
+		count = MIN(p_count, pool_max_size - (int)pool.size());
+		has_snapshot = !pool_snapshot.is_empty();
+	}
+	if (count > 0 && !has_snapshot) {
+		Node *instance = instantiate();
+		ERR_FAIL_NULL(instance);
+		_store_pool_snapshot(instance);
+		_add_to_pool(instance);
+		count--;
+	}
+	if (count <= 0) {
+		return;
+	}
+
+	// Nodes outside of the scene tree can be created from any thread.
+	LocalVector<Node *> instances;
+	instances.resize(count);
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &PackedScene::_prewarm_instance, instances.ptr(), count, -1, true, SNAME("PackedScenePrewarm"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	MutexLock lock(pool_mutex);
+	for (Node *instance : instances) {
+		if (!instance) {
+			continue;
+		}
+		if ((int)pool.size() < pool_max_size) {
+			pool.push_back(instance);
+		} else {
+			memdelete(instance);
+		}
+	}
+}
+
+void PackedScene::clear_pool() {
+	MutexLock lock(pool_mutex);
+	for (Node *instance : pool) {
+		memdelete(instance);
+	}
+	pool.clear();
+	pool_snapshot.clear();
+}
+
+int PackedScene::get_pooled_count() const {
+	MutexLock lock(pool_mutex);
+	return pool.size();
+}
+
+void PackedScene::set_pool_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	MutexLock lock(pool_mutex);
+	pool_max_size = p_size;
+	while ((int)pool.size() > pool_max_size) {
+		memdelete(pool[pool.size() - 1]);
+		pool.remove_at(pool.size() - 1);
+	}
+}
+
+int PackedScene::get_pool_max_size() const {
+	return pool_max_size;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2201,6 +2627,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state.instantiate();
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2279,6 +2706,13 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("release_instance", "instance"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &PackedScene::prewarm);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("get_pooled_count"), &PackedScene::get_pooled_count);
+	ClassDB::bind_method(D_METHOD("set_pool_max_size", "size"), &PackedScene::set_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_max_size"), &PackedScene::get_pool_max_size);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -2294,3 +2728,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
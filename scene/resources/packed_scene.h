@@ -31,6 +31,9 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -88,6 +91,28 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Data resolved once from the packed nodes and connections, reused by every instantiate() call.
+	struct InstantiationPlan {
+		struct PropertySetter {
+			MethodBind *method = nullptr;
+			Variant index; // Nil unless the property is indexed.
+			Variant::Type validated_type = Variant::NIL; // Values of this type can skip argument conversion.
+		};
+
+		LocalVector<PropertySetter> setters; // One per node property, in node order.
+		LocalVector<uint32_t> node_setter_offsets;
+		LocalVector<uint32_t> node_child_counts;
+		LocalVector<Vector<Variant>> connection_binds;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_compiled;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	void _compile_instantiation_plan() const;
+	_FORCE_INLINE_ void _invalidate_instantiation_plan() { instantiation_plan_compiled.clear(); }
+	static void _set_property_from_plan(Node *p_node, const InstantiationPlan::PropertySetter &p_setter, const Variant &p_value, bool &r_valid);
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -237,6 +262,43 @@ class PackedScene : public Resource {
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
+	// Instance pool. Released instances are reset to the state of a freshly
+	// instantiated scene by comparing against a snapshot of its stored
+	// properties and script variables, and only the properties that differ
+	// are set again.
+	struct PoolProperty {
+		enum Kind {
+			KIND_VALUE,
+			KIND_CONTAINER, // Deep copied on every reset, so instances never share it.
+			KIND_NODE, // A node of the instance, resolved from its path on reset.
+			KIND_LOCAL_RESOURCE, // Duplicated on every reset, as on instantiation.
+		};
+
+		StringName name;
+		Variant value;
+		NodePath node_path;
+		Kind kind = KIND_VALUE;
+	};
+
+	struct PoolNodeSnapshot {
+		NodePath path;
+		StringName class_name;
+		int child_count = 0;
+		LocalVector<PoolProperty> properties;
+	};
+
+	LocalVector<PoolNodeSnapshot> pool_snapshot;
+	LocalVector<Node *> pool;
+	int pool_max_size = 64;
+	mutable Mutex pool_mutex;
+
+	static void _build_pool_snapshot(Node *p_instance, LocalVector<PoolNodeSnapshot> &r_snapshot);
+	void _store_pool_snapshot(Node *p_instance);
+	void _add_to_pool(Node *p_instance);
+	bool _reset_pooled_instance(Node *p_instance) const;
+	void _prewarm_instance(uint32_t p_index, Node **p_instances);
+	void _discard_instance(Node *p_instance);
+
 protected:
 	virtual bool editor_can_reload_from_file() override { return false; } // this is handled by editor better
 	static void _bind_methods();
@@ -257,6 +319,14 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	Node *instantiate_pooled();
+	void release_instance(Node *p_instance);
+	void prewarm(int p_count);
+	void clear_pool();
+	int get_pooled_count() const;
+	void set_pool_max_size(int p_size);
+	int get_pool_max_size() const;
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -276,6 +346,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
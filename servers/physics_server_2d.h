@@ -275,6 +275,10 @@ public:
 	virtual Vector<Vector2> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Snapshot of the simulation state of a space, for rollback and resimulation.
+	virtual Vector<uint8_t> space_save_state(RID p_space);
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state);
+
 	//missing space parameters
 
 	/* AREA API */
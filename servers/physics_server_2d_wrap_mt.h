@@ -120,6 +120,16 @@ public:
 		return physics_server_2d->space_get_contact_count(p_space);
 	}
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) override {
+		ERR_FAIL_COND_V(!Thread::is_main_thread(), Vector<uint8_t>());
+		return physics_server_2d->space_save_state(p_space);
+	}
+
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override {
+		ERR_FAIL_COND_V(!Thread::is_main_thread(), ERR_UNAVAILABLE);
+		return physics_server_2d->space_restore_state(p_space, p_state);
+	}
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -475,6 +475,111 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 	return r;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(p_ray_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The 'from' and 'to' arrays must have the same size.");
+
+	const int ray_count = p_from.size();
+	Vector<RayResult> results;
+	results.resize(ray_count);
+	Vector<bool> hits;
+	hits.resize(ray_count);
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), ray_count, results.ptrw(), hits.ptrw());
+
+	PackedVector3Array positions;
+	positions.resize(ray_count);
+	PackedVector3Array normals;
+	normals.resize(ray_count);
+	PackedInt64Array collider_ids;
+	collider_ids.resize(ray_count);
+	PackedInt32Array shapes;
+	shapes.resize(ray_count);
+	PackedInt32Array face_indices;
+	face_indices.resize(ray_count);
+
+	Vector3 *positions_ptr = positions.ptrw();
+	Vector3 *normals_ptr = normals.ptrw();
+	int64_t *collider_ids_ptr = collider_ids.ptrw();
+	int32_t *shapes_ptr = shapes.ptrw();
+	int32_t *face_indices_ptr = face_indices.ptrw();
+	for (int i = 0; i < ray_count; i++) {
+		const RayResult &result = results[i];
+		const bool hit = hits[i];
+		positions_ptr[i] = hit ? result.position : Vector3();
+		normals_ptr[i] = hit ? result.normal : Vector3();
+		collider_ids_ptr[i] = hit ? (int64_t)result.collider_id : 0;
+		shapes_ptr[i] = hit ? result.shape : -1;
+		face_indices_ptr[i] = hit ? result.face_index : -1;
+	}
+
+	Dictionary d;
+	d["position"] = positions;
+	d["normal"] = normals;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+	d["face_index"] = face_indices;
+
+	return d;
+}
+
+Dictionary PhysicsDirectSpaceState3D::_intersect_shapes(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results) {
+	ERR_FAIL_COND_V(p_shape_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V(p_max_results <= 0, Dictionary());
+
+	const int query_count = p_transforms.size();
+	Vector<Transform3D> transforms;
+	transforms.resize(query_count);
+	for (int i = 0; i < query_count; i++) {
+		transforms.write[i] = p_transforms[i];
+	}
+
+	Vector<ShapeResult> results;
+	results.resize(query_count * p_max_results);
+	PackedInt32Array result_counts;
+	result_counts.resize(query_count);
+	intersect_shapes(p_shape_query->get_parameters(), transforms.ptr(), query_count, results.ptrw(), p_max_results, result_counts.ptrw());
+
+	PackedInt64Array collider_ids;
+	collider_ids.resize(query_count * p_max_results);
+	PackedInt32Array shapes;
+	shapes.resize(query_count * p_max_results);
+
+	int64_t *collider_ids_ptr = collider_ids.ptrw();
+	int32_t *shapes_ptr = shapes.ptrw();
+	for (int i = 0; i < query_count; i++) {
+		for (int j = 0; j < p_max_results; j++) {
+			const int index = i * p_max_results + j;
+			const bool hit = j < result_counts[i];
+			collider_ids_ptr[index] = hit ? (int64_t)results[index].collider_id : 0;
+			shapes_ptr[index] = hit ? results[index].shape : -1;
+		}
+	}
+
+	Dictionary d;
+	d["result_count"] = result_counts;
+	d["collider_id"] = collider_ids;
+	d["shape"] = shapes;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_ray_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_query_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, r_results + i * p_result_max, p_result_max);
+	}
+}
+
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
@@ -485,6 +590,8 @@ void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_rays);
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "transforms", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shapes, DEFVAL(8));
 }
 
 ///////////////////////////////
@@ -688,6 +795,31 @@ RID PhysicsServer3D::shape_create(ShapeType p_shape) {
 	}
 }
 
+Vector<uint8_t> PhysicsServer3D::space_save_state(RID p_space) {
+	ERR_FAIL_V_MSG(Vector<uint8_t>(), "Saving space states is not supported by this physics server.");
+}
+
+Error PhysicsServer3D::space_restore_state(RID p_space, const Vector<uint8_t> &p_state) {
+	ERR_FAIL_V_MSG(ERR_UNAVAILABLE, "Restoring space states is not supported by this physics server.");
+}
+
+void PhysicsServer3D::space_set_active_regions(RID p_space, const Vector<AABB> &p_regions) {
+	ERR_FAIL_MSG("Active regions are not supported by this physics server.");
+}
+
+int PhysicsServer3D::space_get_process_info(RID p_space, ProcessInfo p_info) {
+	ERR_FAIL_V_MSG(0, "Per-space process information is not supported by this physics server.");
+}
+
+void PhysicsServer3D::_space_set_active_regions(RID p_space, const TypedArray<AABB> &p_regions) {
+	Vector<AABB> regions;
+	regions.resize(p_regions.size());
+	for (int i = 0; i < p_regions.size(); i++) {
+		regions.write[i] = p_regions[i];
+	}
+	space_set_active_regions(p_space, regions);
+}
+
 void PhysicsServer3D::_bind_methods() {
 #ifndef _3D_DISABLED
 
@@ -715,6 +847,9 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("space_set_param", "space", "param", "value"), &PhysicsServer3D::space_set_param);
 	ClassDB::bind_method(D_METHOD("space_get_param", "space", "param"), &PhysicsServer3D::space_get_param);
 	ClassDB::bind_method(D_METHOD("space_get_direct_state", "space"), &PhysicsServer3D::space_get_direct_state);
+	ClassDB::bind_method(D_METHOD("space_save_state", "space"), &PhysicsServer3D::space_save_state);
+	ClassDB::bind_method(D_METHOD("space_restore_state", "space", "state"), &PhysicsServer3D::space_restore_state);
+	ClassDB::bind_method(D_METHOD("space_set_active_regions", "space", "regions"), &PhysicsServer3D::_space_set_active_regions);
 
 	ClassDB::bind_method(D_METHOD("area_create"), &PhysicsServer3D::area_create);
 	ClassDB::bind_method(D_METHOD("area_set_space", "area", "space"), &PhysicsServer3D::area_set_space);
@@ -1034,6 +1169,7 @@ void PhysicsServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_active", "active"), &PhysicsServer3D::set_active);
 
 	ClassDB::bind_method(D_METHOD("get_process_info", "process_info"), &PhysicsServer3D::get_process_info);
+	ClassDB::bind_method(D_METHOD("space_get_process_info", "space", "process_info"), &PhysicsServer3D::space_get_process_info);
 
 	BIND_ENUM_CONSTANT(SHAPE_WORLD_BOUNDARY);
 	BIND_ENUM_CONSTANT(SHAPE_SEPARATION_RAY);
@@ -1100,6 +1236,13 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_STEP_TIME);
+	BIND_ENUM_CONSTANT(INFO_BROAD_PHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_NARROW_PHASE_TIME);
+	BIND_ENUM_CONSTANT(INFO_SOLVER_TIME);
+	BIND_ENUM_CONSTANT(INFO_INTEGRATION_TIME);
+	BIND_ENUM_CONSTANT(INFO_STATE_SYNC_TIME);
+	BIND_ENUM_CONSTANT(INFO_AREA_CALLBACK_TIME);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
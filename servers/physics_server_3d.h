@@ -126,6 +126,8 @@ private:
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
+	Dictionary _intersect_rays(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
+	Dictionary _intersect_shapes(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results = 8);
 
 protected:
 	static void _bind_methods();
@@ -158,6 +160,10 @@ public:
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
 
+	// Casts p_ray_count rays sharing the filters of p_parameters, whose from and to are ignored.
+	// r_hits[i] tells if r_results[i] was written. Servers may run the rays in parallel.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_ray_count, RayResult *r_results, bool *r_hits);
+
 	struct ShapeResult {
 		RID rid;
 		ObjectID collider_id;
@@ -198,6 +204,10 @@ public:
 	};
 
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) = 0;
+
+	// Intersects the shape of p_parameters placed at each of p_transforms, its own transform is ignored.
+	// Query i writes up to p_result_max results from r_results[i * p_result_max] and its count to r_result_counts[i].
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_query_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) = 0;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) = 0;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) = 0;
@@ -233,6 +243,7 @@ class PhysicsServer3D : public Object {
 	static PhysicsServer3D *singleton;
 
 	virtual bool _body_test_motion(RID p_body, const Ref<PhysicsTestMotionParameters3D> &p_parameters, const Ref<PhysicsTestMotionResult3D> &p_result = Ref<PhysicsTestMotionResult3D>());
+	void _space_set_active_regions(RID p_space, const TypedArray<AABB> &p_regions);
 
 protected:
 	static void _bind_methods();
@@ -305,6 +316,13 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	// Snapshot of the simulation state of a space, for rollback and resimulation.
+	virtual Vector<uint8_t> space_save_state(RID p_space);
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state);
+
+	// Simulation level of detail, islands of bodies outside all the regions are suspended.
+	virtual void space_set_active_regions(RID p_space, const Vector<AABB> &p_regions);
+
 	//missing space parameters
 
 	/* AREA API */
@@ -804,10 +822,18 @@ public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_STEP_TIME,
+		INFO_BROAD_PHASE_TIME,
+		INFO_NARROW_PHASE_TIME,
+		INFO_SOLVER_TIME,
+		INFO_INTEGRATION_TIME,
+		INFO_STATE_SYNC_TIME,
+		INFO_AREA_CALLBACK_TIME
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
+	virtual int space_get_process_info(RID p_space, ProcessInfo p_info);
 
 	PhysicsServer3D();
 	~PhysicsServer3D();
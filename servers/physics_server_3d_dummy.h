@@ -166,6 +166,10 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override { return Vector<Vector3>(); }
 	virtual int space_get_contact_count(RID p_space) const override { return 0; }
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) override { return Vector<uint8_t>(); }
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override { return OK; }
+	virtual void space_set_active_regions(RID p_space, const Vector<AABB> &p_regions) override {}
+
 	/* AREA API */
 
 	virtual RID area_create() override { return RID(); }
@@ -430,4 +434,5 @@ public:
 	virtual bool is_flushing_queries() const override { return false; }
 
 	virtual int get_process_info(ProcessInfo p_info) override { return 0; }
+	virtual int space_get_process_info(RID p_space, ProcessInfo p_info) override { return 0; }
 };
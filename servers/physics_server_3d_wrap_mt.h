@@ -127,6 +127,18 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	virtual Vector<uint8_t> space_save_state(RID p_space) override {
+		ERR_FAIL_COND_V(!Thread::is_main_thread(), Vector<uint8_t>());
+		return physics_server_3d->space_save_state(p_space);
+	}
+
+	virtual Error space_restore_state(RID p_space, const Vector<uint8_t> &p_state) override {
+		ERR_FAIL_COND_V(!Thread::is_main_thread(), ERR_UNAVAILABLE);
+		return physics_server_3d->space_restore_state(p_space, p_state);
+	}
+
+	FUNC2(space_set_active_regions, RID, const Vector<AABB> &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -396,6 +408,10 @@ public:
 		return physics_server_3d->get_process_info(p_info);
 	}
 
+	int space_get_process_info(RID p_space, ProcessInfo p_info) override {
+		return physics_server_3d->space_get_process_info(p_space, p_info);
+	}
+
 	PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread);
 	~PhysicsServer3DWrapMT();
 
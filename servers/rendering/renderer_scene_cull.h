@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/math/dynamic_bvh.h"
+#include "core/math/math_batch.h"
 #include "core/math/transform_interpolator.h"
 #include "core/templates/bin_sorted_array.h"
 #include "core/templates/local_vector.h"
@@ -56,7 +57,8 @@ public:
 		SDFGI_MAX_CASCADES = 8,
 		SDFGI_MAX_REGIONS_PER_CASCADE = 3,
 		MAX_INSTANCE_PAIRS = 32,
-		MAX_UPDATE_SHADOWS = 512
+		MAX_UPDATE_SHADOWS = 512,
+		FRUSTUM_CULL_BATCH_SIZE = 256
 	};
 
 	uint64_t render_pass;
@@ -196,16 +198,14 @@ public:
 		// Because bounds checking is performed first,
 		// keep it separated from data.
 
-		real_t bounds[6];
+		// Kept as a plain array, so contiguous bounds can be tested with MathBatch::frustum_test_bounds().
+		// Always single precision: in double precision builds, bounds are rounded
+		// outwards, which keeps culling conservative at half the memory traffic.
+		float bounds[6];
 		_ALWAYS_INLINE_ InstanceBounds() {}
 
 		_ALWAYS_INLINE_ InstanceBounds(const AABB &p_aabb) {
-			bounds[0] = p_aabb.position.x;
-			bounds[1] = p_aabb.position.y;
-			bounds[2] = p_aabb.position.z;
-			bounds[3] = p_aabb.position.x + p_aabb.size.x;
-			bounds[4] = p_aabb.position.y + p_aabb.size.y;
-			bounds[5] = p_aabb.position.z + p_aabb.size.z;
+			MathBatch::store_bounds(p_aabb, bounds);
 		}
 		_ALWAYS_INLINE_ bool in_frustum(const Frustum &p_frustum) const {
 			// This is not a full SAT check and the possibility of false positives exist,
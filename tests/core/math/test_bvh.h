@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/bvh.h"
+#include "core/math/random_pcg.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+template <typename T>
+class PairAllFunction {
+public:
+	static bool user_pair_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+template <typename T>
+class CullAllFunction {
+public:
+	static bool user_cull_check(const T *p_a, const T *p_b) {
+		return true;
+	}
+};
+
+typedef BVH_Manager<int, 2, true, 128, PairAllFunction<int>, CullAllFunction<int>> PairingBVH;
+
+// Pair and unpair callbacks in the order they were received, as (paired, handle A, handle B).
+typedef LocalVector<Vector3i> PairingLog;
+
+static void *log_pair(void *p_log, uint32_t p_a, int *p_object_a, int p_subindex_a, uint32_t p_b, int *p_object_b, int p_subindex_b) {
+	static_cast<PairingLog *>(p_log)->push_back(Vector3i(1, p_a, p_b));
+	return nullptr;
+}
+
+static void log_unpair(void *p_log, uint32_t p_a, int *p_object_a, int p_subindex_a, uint32_t p_b, int *p_object_b, int p_subindex_b, void *p_pair_data) {
+	static_cast<PairingLog *>(p_log)->push_back(Vector3i(0, p_a, p_b));
+}
+
+static bool logs_match(const PairingLog &p_a, const PairingLog &p_b) {
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < p_a.size(); i++) {
+		if (p_a[i] != p_b[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static AABB random_box(RandomPCG &p_rng) {
+	return AABB(Vector3(p_rng.random(0.0f, 40.0f), p_rng.random(0.0f, 40.0f), p_rng.random(0.0f, 40.0f)), Vector3(1, 1, 1));
+}
+
+TEST_CASE("[BVH] Threaded pairing matches serial pairing") {
+	constexpr int ITEM_COUNT = 2000;
+	constexpr int STEP_COUNT = 5;
+	constexpr int MOVED_COUNT = ITEM_COUNT / 2;
+	static_assert(MOVED_COUNT > PairingBVH::THREADED_PAIRING_MIN_ITEMS);
+
+	LocalVector<int> objects;
+	objects.resize(ITEM_COUNT);
+	PairingBVH serial;
+	PairingBVH threaded;
+	PairingLog serial_log;
+	PairingLog threaded_log;
+	serial.set_pair_callback(log_pair, &serial_log);
+	serial.set_unpair_callback(log_unpair, &serial_log);
+	threaded.set_pair_callback(log_pair, &threaded_log);
+	threaded.set_unpair_callback(log_unpair, &threaded_log);
+
+	RandomPCG rng(42);
+	LocalVector<BVHHandle> serial_handles;
+	LocalVector<BVHHandle> threaded_handles;
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		const AABB box = random_box(rng);
+		serial_handles.push_back(serial.create(&objects[i], true, 0, 1, box));
+		threaded_handles.push_back(threaded.create(&objects[i], true, 0, 1, box));
+	}
+	REQUIRE(logs_match(serial_log, threaded_log));
+
+	for (int step = 0; step < STEP_COUNT; step++) {
+		serial_log.clear();
+		threaded_log.clear();
+		for (int i = 0; i < MOVED_COUNT; i++) {
+			const uint32_t index = rng.rand() % ITEM_COUNT;
+			const AABB box = random_box(rng);
+			serial.move(serial_handles[index], box);
+			threaded.move(threaded_handles[index], box);
+		}
+		serial.update();
+		threaded.update_threaded();
+
+		CHECK_FALSE(serial_log.is_empty());
+		CHECK_MESSAGE(logs_match(serial_log, threaded_log), vformat("Pairing differs at step %d.", step));
+	}
+
+	for (int i = 0; i < ITEM_COUNT; i++) {
+		serial.erase(serial_handles[i]);
+		threaded.erase(threaded_handles[i]);
+	}
+}
+
+} // namespace TestBVH
@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*  test_math_batch.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/math_batch.h"
+#include "core/math/projection.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMathBatch {
+
+Vector3 random_vector(RandomPCG &p_rng) {
+	return Vector3(p_rng.random(-10.0f, 10.0f), p_rng.random(-10.0f, 10.0f), p_rng.random(-10.0f, 10.0f));
+}
+
+Transform3D random_transform(RandomPCG &p_rng) {
+	return Transform3D(Basis(random_vector(p_rng), random_vector(p_rng), random_vector(p_rng)), random_vector(p_rng));
+}
+
+AABB random_aabb(RandomPCG &p_rng) {
+	return AABB(random_vector(p_rng), random_vector(p_rng).abs());
+}
+
+bool aabb_is_equal_approx(const AABB &p_a, const AABB &p_b) {
+	return p_a.position.is_equal_approx(p_b.position) && p_a.size.is_equal_approx(p_b.size);
+}
+
+// Odd count, so that any remainder handling is exercised.
+constexpr uint32_t COUNT = 37;
+
+TEST_CASE("[MathBatch] Transform points") {
+	RandomPCG rng(1);
+	const Transform3D xform = random_transform(rng);
+	Vector3 src[COUNT];
+	Vector3 dst[COUNT];
+	for (uint32_t i = 0; i < COUNT; i++) {
+		src[i] = random_vector(rng);
+	}
+
+	MathBatch::xform_points(xform, src, dst, COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		CHECK(dst[i].is_equal_approx(xform.xform(src[i])));
+	}
+
+	// In-place.
+	MathBatch::xform_points(xform, src, src, COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		CHECK(src[i].is_equal_approx(dst[i]));
+	}
+}
+
+TEST_CASE("[MathBatch] Compose transforms") {
+	RandomPCG rng(2);
+	const Transform3D parent = random_transform(rng);
+	Transform3D parents[COUNT];
+	Transform3D src[COUNT];
+	Transform3D dst[COUNT];
+	for (uint32_t i = 0; i < COUNT; i++) {
+		parents[i] = random_transform(rng);
+		src[i] = random_transform(rng);
+	}
+
+	MathBatch::compose_transforms(parent, src, dst, COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		CHECK(dst[i].is_equal_approx(parent * src[i]));
+	}
+
+	MathBatch::compose_transforms(parents, src, dst, COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		CHECK(dst[i].is_equal_approx(parents[i] * src[i]));
+	}
+}
+
+TEST_CASE("[MathBatch] Transform AABBs") {
+	RandomPCG rng(3);
+	const Transform3D xform = random_transform(rng);
+	const AABB aabb = random_aabb(rng);
+	Transform3D xforms[COUNT];
+	AABB src[COUNT];
+	AABB dst[COUNT];
+	for (uint32_t i = 0; i < COUNT; i++) {
+		xforms[i] = random_transform(rng);
+		src[i] = random_aabb(rng);
+	}
+
+	MathBatch::xform_aabbs(xform, src, dst, COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		CHECK(aabb_is_equal_approx(dst[i], xform.xform(src[i])));
+	}
+
+	MathBatch::xform_aabb(xforms, aabb, dst, COUNT);
+	for (uint32_t i = 0; i < COUNT; i++) {
+		CHECK(aabb_is_equal_approx(dst[i], xforms[i].xform(aabb)));
+	}
+}
+
+TEST_CASE("[MathBatch] Merge transformed AABB") {
+	RandomPCG rng(4);
+	const AABB aabb = random_aabb(rng);
+	// MultiMesh layout: three rows of basis + origin, followed by 4 floats of color.
+	constexpr uint32_t STRIDE = 16;
+	float data[COUNT * STRIDE];
+	AABB expected;
+	for (uint32_t i = 0; i < COUNT; i++) {
+		const Transform3D xform = random_transform(rng);
+		float *row = data + i * STRIDE;
+		for (int j = 0; j < 3; j++) {
+			row[j * 4 + 0] = xform.basis.rows[j].x;
+			row[j * 4 + 1] = xform.basis.rows[j].y;
+			row[j * 4 + 2] = xform.basis.rows[j].z;
+			row[j * 4 + 3] = xform.origin[j];
+		}
+		for (int j = 12; j < 16; j++) {
+			row[j] = rng.randf();
+		}
+
+		Transform3D t;
+		for (int j = 0; j < 3; j++) {
+			t.basis.rows[j] = Vector3(row[j * 4 + 0], row[j * 4 + 1], row[j * 4 + 2]);
+			t.origin[j] = row[j * 4 + 3];
+		}
+		if (i == 0) {
+			expected = t.xform(aabb);
+		} else {
+			expected.merge_with(t.xform(aabb));
+		}
+	}
+
+	CHECK(aabb_is_equal_approx(MathBatch::merge_xformed_aabb(aabb, data, STRIDE, COUNT), expected));
+	CHECK_MESSAGE(MathBatch::merge_xformed_aabb(aabb, data, STRIDE, 0) == AABB(), "No transforms should produce an empty AABB.");
+}
+
+TEST_CASE("[MathBatch] Store bounds") {
+	// Far from the origin, where single precision cannot represent every value.
+	const AABB aabb(Vector3(1000000.1, -2000000.3, 3000000.7), Vector3(0.3, 0.5, 0.7));
+	float bounds[6];
+	MathBatch::store_bounds(aabb, bounds);
+	const Vector3 end = aabb.position + aabb.size;
+	for (int i = 0; i < 3; i++) {
+		CHECK(bounds[i] <= aabb.position[i]);
+		CHECK(bounds[i + 3] >= end[i]);
+		CHECK(Math::is_equal_approx(bounds[i], (float)aabb.position[i]));
+		CHECK(Math::is_equal_approx(bounds[i + 3], (float)end[i]));
+	}
+}
+
+TEST_CASE("[MathBatch] Frustum test") {
+	RandomPCG rng(5);
+	// More than the number of planes handled in one pass, to test both paths.
+	constexpr uint32_t PLANE_COUNT = 40;
+	Plane planes[PLANE_COUNT];
+	for (uint32_t i = 0; i < PLANE_COUNT; i++) {
+		planes[i] = Plane(random_vector(rng).normalized(), rng.random(-20.0f, 20.0f));
+	}
+	AABB aabbs[COUNT];
+	for (uint32_t i = 0; i < COUNT; i++) {
+		aabbs[i] = random_aabb(rng);
+	}
+
+	for (uint32_t plane_count : { 0u, 6u, PLANE_COUNT }) {
+		uint8_t inside[COUNT];
+		MathBatch::frustum_test_aabbs(planes, plane_count, aabbs, COUNT, inside);
+		for (uint32_t i = 0; i < COUNT; i++) {
+			const Vector3 end = aabbs[i].position + aabbs[i].size;
+			bool expected = true;
+			for (uint32_t j = 0; j < plane_count; j++) {
+				const Vector3 &n = planes[j].normal;
+				Vector3 corner(n.x > 0 ? aabbs[i].position.x : end.x, n.y > 0 ? aabbs[i].position.y : end.y, n.z > 0 ? aabbs[i].position.z : end.z);
+				if (planes[j].distance_to(corner) >= 0) {
+					expected = false;
+					break;
+				}
+			}
+#ifdef REAL_T_IS_DOUBLE
+			// Bounds are rounded outwards to single precision, so the test may only keep more boxes.
+			CHECK((inside[i] || !expected));
+#else
+			CHECK(bool(inside[i]) == expected);
+#endif
+		}
+	}
+
+	// A box fully inside the unit frustum is kept, one fully outside is rejected.
+	const Plane box_planes[6] = {
+		Plane(Vector3(1, 0, 0), 1), Plane(Vector3(-1, 0, 0), 1),
+		Plane(Vector3(0, 1, 0), 1), Plane(Vector3(0, -1, 0), 1),
+		Plane(Vector3(0, 0, 1), 1), Plane(Vector3(0, 0, -1), 1)
+	};
+	const AABB boxes[2] = { AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)), AABB(Vector3(2, 2, 2), Vector3(1, 1, 1)) };
+	uint8_t inside[2];
+	MathBatch::frustum_test_aabbs(box_planes, 6, boxes, 2, inside);
+	CHECK(inside[0] == 1);
+	CHECK(inside[1] == 0);
+}
+
+} // namespace TestMathBatch
@@ -33,6 +33,8 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
 
@@ -600,4 +602,71 @@ TEST_CASE("[Object] Destruction at the end of the call chain is safe") {
 			"Object was tail-deleted without crashes.");
 }
 
+TEST_CASE("[Object] ObjectDB lookups during concurrent allocation") {
+	// Readers resolve a fixed set of live and freed IDs while the main thread allocates and frees
+	// enough objects to add new slot pages and reuse freed slots.
+	constexpr uint32_t LIVE_COUNT = 64;
+	constexpr uint32_t CHURN_COUNT = OBJECTDB_SLOT_PAGE_SIZE + 1000;
+
+	struct LookupTester {
+		Object *live[LIVE_COUNT] = {};
+		ObjectID live_ids[LIVE_COUNT];
+		ObjectID freed_ids[LIVE_COUNT];
+		TightLocalVector<Thread> threads;
+		std::atomic<bool> done = false;
+		std::atomic<uint32_t> errors = 0;
+	} tester;
+
+	for (uint32_t i = 0; i < LIVE_COUNT; i++) {
+		Object *freed = memnew(Object);
+		tester.freed_ids[i] = freed->get_instance_id();
+		memdelete(freed);
+		tester.live[i] = memnew(Object);
+		tester.live_ids[i] = tester.live[i]->get_instance_id();
+	}
+
+	tester.threads.resize(MAX(2, OS::get_singleton()->get_processor_count() - 1));
+	for (Thread &thread : tester.threads) {
+		thread.start(
+				[](void *p_data) {
+					LookupTester *lt = (LookupTester *)p_data;
+					uint32_t local_errors = 0;
+					while (!lt->done.load(std::memory_order_acquire)) {
+						for (uint32_t i = 0; i < LIVE_COUNT; i++) {
+							if (ObjectDB::get_instance(lt->live_ids[i]) != lt->live[i]) {
+								local_errors++;
+							}
+							if (ObjectDB::get_instance(lt->freed_ids[i]) != nullptr) {
+								local_errors++;
+							}
+						}
+					}
+					lt->errors.fetch_add(local_errors, std::memory_order_relaxed);
+				},
+				&tester);
+	}
+
+	LocalVector<Object *> churn;
+	churn.resize(CHURN_COUNT);
+	for (uint32_t round = 0; round < 4; round++) {
+		for (uint32_t i = 0; i < CHURN_COUNT; i++) {
+			churn[i] = memnew(Object);
+		}
+		for (uint32_t i = 0; i < CHURN_COUNT; i++) {
+			memdelete(churn[i]);
+		}
+	}
+
+	tester.done.store(true, std::memory_order_release);
+	for (Thread &thread : tester.threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_MESSAGE(tester.errors.load() == 0, "Concurrent lookups returned only the registered objects.");
+
+	for (uint32_t i = 0; i < LIVE_COUNT; i++) {
+		memdelete(tester.live[i]);
+	}
+}
+
 } // namespace TestObject
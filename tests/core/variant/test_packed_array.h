@@ -0,0 +1,148 @@
+/**************************************************************************/
+/*  test_packed_array.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/variant/variant.h"
+#include "tests/test_macros.h"
+
+namespace TestPackedArray {
+
+TEST_CASE("[PackedArray] Bulk arithmetic on PackedFloat32Array") {
+	PackedFloat32Array values = { 1.0, -2.0, 3.0, 4.5, 0.5 };
+	Variant array = values;
+
+	array.call("scale", 2.0);
+	array.call("offset", 1.0);
+	CHECK(PackedFloat32Array(array) == PackedFloat32Array({ 3.0, -3.0, 7.0, 10.0, 2.0 }));
+
+	array.call("multiply_add", 0.5, -1.0);
+	CHECK(PackedFloat32Array(array) == PackedFloat32Array({ 0.5, -2.5, 2.5, 4.0, 0.0 }));
+
+	array.call("clamp", -1.0, 3.0);
+	CHECK(PackedFloat32Array(array) == PackedFloat32Array({ 0.5, -1.0, 2.5, 3.0, 0.0 }));
+
+	CHECK(double(array.call("sum")) == doctest::Approx(5.0));
+	CHECK(double(array.call("min")) == doctest::Approx(-1.0));
+	CHECK(double(array.call("max")) == doctest::Approx(3.0));
+	CHECK(double(array.call("dot", PackedFloat32Array({ 2.0, 1.0, 2.0, 1.0, 5.0 }))) == doctest::Approx(8.0));
+
+	array.call("lerp", PackedFloat32Array({ 1.5, 1.0, 2.5, 5.0, 2.0 }), 0.5);
+	CHECK(PackedFloat32Array(array) == PackedFloat32Array({ 1.0, 0.0, 2.5, 4.0, 1.0 }));
+}
+
+TEST_CASE("[PackedArray] Bulk element-wise operations require matching sizes") {
+	Variant array = PackedInt32Array({ 1, 2, 3 });
+
+	array.call("add_array", PackedInt32Array({ 10, 20, 30 }));
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ 11, 22, 33 }));
+
+	array.call("multiply_array", PackedInt32Array({ 2, 0, -1 }));
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ 22, 0, -33 }));
+
+	ERR_PRINT_OFF;
+	array.call("add_array", PackedInt32Array({ 1, 2 }));
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(PackedInt32Array(array) == PackedInt32Array({ 22, 0, -33 }), "A size mismatch should leave the array untouched.");
+}
+
+TEST_CASE("[PackedArray] Integer arithmetic wraps around") {
+	Variant array = PackedInt32Array({ INT32_MAX, INT32_MIN, 2 });
+
+	array.call("offset", 1);
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ INT32_MIN, INT32_MIN + 1, 3 }));
+
+	array.call("scale", 2);
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ 0, 2, 6 }));
+
+	// Arguments outside of the 32-bit range wrap the same way as the elements.
+	array.call("offset", int64_t(1) << 32);
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ 0, 2, 6 }));
+
+	array.call("multiply_add", int64_t(INT32_MAX) + 1, -1);
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ -1, -1, -1 }));
+
+	array.call("add_array", PackedInt32Array({ INT32_MIN, 0, 1 }));
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ INT32_MAX, -1, 0 }));
+
+	array.call("multiply_array", PackedInt32Array({ 2, INT32_MIN, 5 }));
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ -2, INT32_MIN, 0 }));
+
+	// Bounds outside of the 32-bit range saturate instead.
+	array.call("clamp", int64_t(INT32_MIN) - 10, int64_t(INT32_MAX) + 10);
+	CHECK(PackedInt32Array(array) == PackedInt32Array({ -2, INT32_MIN, 0 }));
+
+	CHECK(int64_t(Variant(PackedInt32Array({ INT32_MIN, INT32_MIN })).call("dot", PackedInt32Array({ INT32_MIN, INT32_MIN }))) == INT64_MIN);
+}
+
+TEST_CASE("[PackedArray] Sums don't lose precision or overflow") {
+	PackedInt32Array ints;
+	ints.resize(1003);
+	ints.fill(INT32_MAX);
+	CHECK(int64_t(Variant(ints).call("sum")) == int64_t(INT32_MAX) * 1003);
+
+	PackedFloat32Array floats;
+	floats.resize(1003);
+	floats.fill(0.1f);
+	CHECK(double(Variant(floats).call("sum")) == doctest::Approx(double(0.1f) * 1003));
+
+	CHECK(double(Variant(PackedFloat64Array()).call("sum")) == 0.0);
+}
+
+TEST_CASE("[PackedArray] Bulk operations on vector and color arrays") {
+	Variant vectors = PackedVector3Array({ Vector3(1, 0, 0), Vector3(0, 2, 0), Vector3(0, 0, -3) });
+	vectors.call("scale", 2.0);
+	vectors.call("offset", Vector3(1, 1, 1));
+	CHECK(PackedVector3Array(vectors) == PackedVector3Array({ Vector3(3, 1, 1), Vector3(1, 5, 1), Vector3(1, 1, -5) }));
+	CHECK(Vector3(vectors.call("sum")).is_equal_approx(Vector3(5, 7, -3)));
+
+	vectors.call("clamp", Vector3(0, 0, -1), Vector3(2, 2, 2));
+	CHECK(PackedVector3Array(vectors) == PackedVector3Array({ Vector3(2, 1, 1), Vector3(1, 2, 1), Vector3(1, 1, -1) }));
+
+	const Transform3D xform = Transform3D(Basis(Vector3(0, 1, 0), Math_PI / 2), Vector3(10, 0, 0));
+	const PackedVector3Array expected = xform.xform(PackedVector3Array(vectors));
+	vectors.call("transform", xform);
+	const PackedVector3Array transformed = vectors;
+	for (int i = 0; i < transformed.size(); i++) {
+		CHECK(transformed[i].is_equal_approx(expected[i]));
+	}
+
+	Variant points = PackedVector2Array({ Vector2(1, 2), Vector2(-1, 0) });
+	points.call("transform", Transform2D(0, Vector2(5, 5)));
+	CHECK(PackedVector2Array(points) == PackedVector2Array({ Vector2(6, 7), Vector2(4, 5) }));
+
+	Variant colors = PackedColorArray({ Color(0, 0, 0, 0), Color(1, 1, 1, 1) });
+	colors.call("lerp", PackedColorArray({ Color(1, 1, 1, 1), Color(0, 0, 0, 0) }), 0.25);
+	CHECK(PackedColorArray(colors) == PackedColorArray({ Color(0.25, 0.25, 0.25, 0.25), Color(0.75, 0.75, 0.75, 0.75) }));
+	CHECK(Color(colors.call("sum")).is_equal_approx(Color(1, 1, 1, 1)));
+}
+
+} // namespace TestPackedArray
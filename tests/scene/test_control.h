@@ -1106,4 +1106,51 @@ TEST_CASE("[SceneTree][Control] Grow direction") {
 	memdelete(test_control);
 }
 
+TEST_CASE("[SceneTree][Control] Duplicate") {
+	Control *node = memnew(Control);
+	node->set_name("Node");
+	node->set_anchors_and_offsets_preset(Control::PRESET_CENTER_TOP);
+	node->set_custom_minimum_size(Size2(30, 40));
+	node->set_rotation(0.5);
+	node->set_pivot_offset(Vector2(5, 5));
+	node->set_h_size_flags(Control::SIZE_EXPAND_FILL);
+	node->set_tooltip_text("Tooltip");
+	node->set_focus_mode(Control::FOCUS_ALL);
+	node->set_mouse_filter(Control::MOUSE_FILTER_PASS);
+	node->set_modulate(Color(1, 0, 0));
+	Control *child = memnew(Control);
+	child->set_name("Child");
+	node->add_child(child);
+	child->set_anchor_and_offset(SIDE_RIGHT, 0.5, 10);
+	child->set_focus_neighbor(SIDE_LEFT, NodePath(".."));
+
+	SUBCASE("Properties are copied") {
+		Control *copy = Object::cast_to<Control>(node->duplicate());
+		REQUIRE(copy);
+
+		const Node *originals[] = { node, child };
+		const Node *copies[] = { copy, copy->get_child(0) };
+		for (int i = 0; i < 2; i++) {
+			List<PropertyInfo> props;
+			originals[i]->get_property_list(&props);
+			for (const PropertyInfo &E : props) {
+				if (E.usage & PROPERTY_USAGE_STORAGE) {
+					CHECK_MESSAGE(copies[i]->get(E.name) == originals[i]->get(E.name), vformat("Property \"%s\" of %s was not duplicated.", E.name, originals[i]->get_name()));
+				}
+			}
+		}
+		memdelete(copy);
+	}
+
+	SUBCASE("Shortcut contexts are remapped") {
+		node->set_shortcut_context(child);
+		Control *copy = Object::cast_to<Control>(node->duplicate());
+		REQUIRE(copy);
+		CHECK_EQ(copy->get_shortcut_context(), copy->get_child(0));
+		memdelete(copy);
+	}
+
+	memdelete(node);
+}
+
 } // namespace TestControl
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/random_pcg.h"
 #include "core/object/class_db.h"
 #include "scene/main/node.h"
 #include "scene/resources/packed_scene.h"
@@ -98,6 +99,56 @@ public:
 	Array get_exported_nodes() const { return exported_nodes; }
 };
 
+class BatchedTestNode : public Node {
+	GDCLASS(BatchedTestNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		switch (p_what) {
+			case NOTIFICATION_PROCESS: {
+				process_counter++;
+			} break;
+			case NOTIFICATION_PHYSICS_PROCESS: {
+				physics_process_counter++;
+			} break;
+		}
+	}
+
+	void _process_batch(double p_delta, Span<Node *> p_nodes) override {
+		batch_counter++;
+		for (Node *node : p_nodes) {
+			Object::cast_to<BatchedTestNode>(node)->batched_process_counter++;
+			if (callback_list) {
+				callback_list->push_back(node);
+			}
+		}
+	}
+
+	void _physics_process_batch(double p_delta, Span<Node *> p_nodes) override {
+		batch_counter++;
+		for (Node *node : p_nodes) {
+			Object::cast_to<BatchedTestNode>(node)->batched_physics_process_counter++;
+		}
+	}
+
+	bool _has_process_batch(bool p_physics) const override {
+		return true;
+	}
+
+public:
+	int process_counter = 0;
+	int physics_process_counter = 0;
+	int batched_process_counter = 0;
+	int batched_physics_process_counter = 0;
+
+	static inline int batch_counter = 0;
+	List<Node *> *callback_list = nullptr;
+
+	BatchedTestNode() {
+		set_process_batched(true);
+	}
+};
+
 TEST_CASE("[SceneTree][Node] Testing node operations with a very simple scene tree") {
 	Node *node = memnew(Node);
 
@@ -891,4 +942,501 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Batched processing") {
+	List<Node *> process_order;
+	Window *root = SceneTree::get_singleton()->get_root();
+	BatchedTestNode::batch_counter = 0;
+
+	BatchedTestNode *batched1 = memnew(BatchedTestNode);
+	batched1->callback_list = &process_order;
+	root->add_child(batched1);
+
+	TestNode *node = memnew(TestNode);
+	node->callback_list = &process_order;
+	root->add_child(node);
+
+	BatchedTestNode *batched2 = memnew(BatchedTestNode);
+	batched2->callback_list = &process_order;
+	root->add_child(batched2);
+
+	BatchedTestNode *batched3 = memnew(BatchedTestNode);
+	batched3->callback_list = &process_order;
+	root->add_child(batched3);
+
+	batched1->set_process(true);
+	batched2->set_process(true);
+	batched3->set_process(true);
+	node->set_process(true);
+
+	SUBCASE("Nodes of the same class are processed in a single batch, in place of the first one") {
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(BatchedTestNode::batch_counter, 1);
+		CHECK_EQ(batched1->batched_process_counter, 1);
+		CHECK_EQ(batched2->batched_process_counter, 1);
+		CHECK_EQ(batched3->batched_process_counter, 1);
+		CHECK_EQ(batched1->process_counter, 0);
+		CHECK_EQ(node->process_counter, 1);
+
+		CHECK_EQ(4, process_order.size());
+		List<Node *>::Element *E = process_order.front();
+		CHECK_EQ(E->get(), batched1);
+		E = E->next();
+		CHECK_EQ(E->get(), batched2);
+		E = E->next();
+		CHECK_EQ(E->get(), batched3);
+		E = E->next();
+		CHECK_EQ(E->get(), node);
+	}
+
+	SUBCASE("Nodes that can't process are left out of the batch") {
+		batched2->set_process(false);
+		batched3->set_process_mode(Node::PROCESS_MODE_DISABLED);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(BatchedTestNode::batch_counter, 1);
+		CHECK_EQ(batched1->batched_process_counter, 1);
+		CHECK_EQ(batched2->batched_process_counter, 0);
+		CHECK_EQ(batched3->batched_process_counter, 0);
+	}
+
+	SUBCASE("Nodes with different priorities are processed in different batches") {
+		batched3->set_process_priority(10);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(BatchedTestNode::batch_counter, 2);
+		CHECK_EQ(batched1->batched_process_counter, 1);
+		CHECK_EQ(batched2->batched_process_counter, 1);
+		CHECK_EQ(batched3->batched_process_counter, 1);
+		CHECK_EQ(process_order.back()->get(), batched3);
+	}
+
+	SUBCASE("Nodes without batching are processed one by one") {
+		batched1->set_process_batched(false);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(BatchedTestNode::batch_counter, 1);
+		CHECK_EQ(batched1->batched_process_counter, 0);
+		CHECK_EQ(batched1->process_counter, 1);
+		CHECK_EQ(batched2->batched_process_counter, 1);
+
+		// Classes not overriding the batch callback are also processed one by one.
+		node->set_process_batched(true);
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(node->process_counter, 2);
+	}
+
+	SUBCASE("Nodes not overriding the batch callback keep their place in the processing order") {
+		TestNode *other = memnew(TestNode);
+		other->callback_list = &process_order;
+		root->add_child(other);
+		TestNode *node2 = memnew(TestNode);
+		node2->callback_list = &process_order;
+		root->add_child(node2);
+
+		node->set_process_batched(true);
+		node2->set_process_batched(true);
+		other->set_process(true);
+		node2->set_process(true);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(node->process_counter, 1);
+		CHECK_EQ(node2->process_counter, 1);
+		CHECK_EQ(6, process_order.size());
+		List<Node *>::Element *E = process_order.front();
+		CHECK_EQ(E->get(), batched1);
+		E = E->next();
+		CHECK_EQ(E->get(), batched2);
+		E = E->next();
+		CHECK_EQ(E->get(), batched3);
+		E = E->next();
+		CHECK_EQ(E->get(), node);
+		E = E->next();
+		CHECK_EQ(E->get(), other);
+		E = E->next();
+		CHECK_EQ(E->get(), node2);
+
+		memdelete(node2);
+		memdelete(other);
+	}
+
+	SUBCASE("Physics process") {
+		batched1->set_physics_process(true);
+		batched2->set_physics_process(true);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(BatchedTestNode::batch_counter, 1);
+		CHECK_EQ(batched1->batched_physics_process_counter, 1);
+		CHECK_EQ(batched2->batched_physics_process_counter, 1);
+		CHECK_EQ(batched1->physics_process_counter, 0);
+	}
+
+	memdelete(batched1);
+	memdelete(node);
+	memdelete(batched2);
+	memdelete(batched3);
+}
+
+static void _check_group_order(const StringName &p_group, Node *p_parent) {
+	Vector<Node *> nodes = SceneTree::get_singleton()->get_nodes_in_group(p_group);
+	int index = 0;
+	for (int i = 0; i < p_parent->get_child_count(); i++) {
+		Node *child = p_parent->get_child(i);
+		if (child->is_in_group(p_group)) {
+			REQUIRE_LT(index, nodes.size());
+			CHECK_EQ(nodes[index], child);
+			index++;
+		}
+	}
+	CHECK_EQ(index, nodes.size());
+}
+
+TEST_CASE("[SceneTree][Node] Group order and views") {
+	constexpr int NODE_COUNT = 20;
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	for (int i = 0; i < NODE_COUNT; i++) {
+		parent->add_child(memnew(Node));
+	}
+
+	// Added in an order unrelated to the tree order.
+	for (int i = 0; i < NODE_COUNT; i += 2) {
+		parent->get_child((i * 7) % NODE_COUNT)->add_to_group("nodes");
+	}
+	_check_group_order("nodes", parent);
+
+	SUBCASE("Nodes added to and removed from a sorted group") {
+		for (int i = 1; i < NODE_COUNT; i += 4) {
+			parent->get_child((i * 7) % NODE_COUNT)->add_to_group("nodes");
+		}
+		parent->get_child(4)->remove_from_group("nodes");
+		parent->get_child(NODE_COUNT - 1)->add_to_group("nodes");
+		_check_group_order("nodes", parent);
+
+		parent->move_child(parent->get_child(0), NODE_COUNT - 1);
+		parent->get_child(3)->add_to_group("nodes");
+		_check_group_order("nodes", parent);
+	}
+
+	SUBCASE("Views are cached until the group changes") {
+		TypedArray<Node> view = SceneTree::get_singleton()->get_nodes_in_group_view("nodes");
+		CHECK(view.is_read_only());
+		CHECK_EQ(view.size(), NODE_COUNT / 2);
+		CHECK_EQ(Object::cast_to<Node>(view[0]), SceneTree::get_singleton()->get_nodes_in_group("nodes")[0]);
+		CHECK_EQ(SceneTree::get_singleton()->get_nodes_in_group_view("nodes").id(), view.id());
+
+		parent->get_child(1)->add_to_group("nodes");
+		TypedArray<Node> new_view = SceneTree::get_singleton()->get_nodes_in_group_view("nodes");
+		CHECK_NE(new_view.id(), view.id());
+		CHECK_EQ(new_view.size(), NODE_COUNT / 2 + 1);
+		CHECK_EQ(Object::cast_to<Node>(new_view[1]), parent->get_child(1));
+		// Views already returned are left as they were.
+		CHECK_EQ(view.size(), NODE_COUNT / 2);
+
+		parent->get_child(0)->remove_from_group("nodes");
+		CHECK_EQ(SceneTree::get_singleton()->get_nodes_in_group_view("nodes").size(), NODE_COUNT / 2);
+
+		parent->move_child(parent->get_child(1), NODE_COUNT - 1);
+		view = SceneTree::get_singleton()->get_nodes_in_group_view("nodes");
+		CHECK_EQ(Object::cast_to<Node>(view[view.size() - 1]), parent->get_child(NODE_COUNT - 1));
+
+		CHECK(SceneTree::get_singleton()->get_nodes_in_group_view("missing").is_empty());
+	}
+
+	memdelete(parent);
+}
+
+#ifdef DEBUG_ENABLED
+class ThreadGroupTestNode : public Node {
+	GDCLASS(ThreadGroupTestNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			process_counter.increment();
+			if (other) {
+				other->set_process_priority(other->get_process_priority());
+			}
+			if (call_target) {
+				call_target->call(SNAME("set_process_priority"), 7);
+			}
+			if (result_target) {
+				Callable::CallError ce;
+				result = result_target->callp(SNAME("get_process_priority"), nullptr, 0, ce);
+				result_error = ce.error;
+			}
+		}
+	}
+
+public:
+	SafeNumeric<int> process_counter;
+	Node *other = nullptr;
+	Node *call_target = nullptr;
+	Node *result_target = nullptr;
+	Variant result;
+	Callable::CallError::Error result_error = Callable::CallError::CALL_OK;
+};
+
+TEST_CASE("[SceneTree][Node] Automatic process thread groups") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *outside = memnew(Node);
+	tree->get_root()->add_child(outside);
+
+	Node *group_owner = memnew(Node);
+	group_owner->set_process_thread_group(Node::PROCESS_THREAD_GROUP_AUTOMATIC);
+	ThreadGroupTestNode *node = memnew(ThreadGroupTestNode);
+	node->set_process(true);
+	group_owner->add_child(node);
+	tree->get_root()->add_child(group_owner);
+
+	TypedArray<Dictionary> groups = tree->get_automatic_thread_groups();
+	REQUIRE_EQ(groups.size(), 1);
+	CHECK_EQ(Object::cast_to<Node>(groups[0].get("node")), group_owner);
+	CHECK(bool(groups[0].get("checking")));
+
+	SUBCASE("Thread groups only accessing their own nodes are moved to a sub-thread") {
+		for (uint32_t i = 0; i < SceneTree::AUTOMATIC_THREAD_GROUP_CHECK_FRAMES; i++) {
+			tree->process(0);
+		}
+
+		groups = tree->get_automatic_thread_groups();
+		CHECK_FALSE(bool(groups[0].get("checking")));
+		CHECK(bool(groups[0].get("threaded")));
+		CHECK(String(groups[0].get("reason")).is_empty());
+
+		tree->process(0);
+		CHECK_EQ(node->process_counter.get(), (int)SceneTree::AUTOMATIC_THREAD_GROUP_CHECK_FRAMES + 1);
+	}
+
+	SUBCASE("Only one process pass per frame counts toward the check") {
+		node->set_physics_process(true);
+		for (uint32_t i = 0; i < SceneTree::AUTOMATIC_THREAD_GROUP_CHECK_FRAMES - 1; i++) {
+			tree->physics_process(0);
+			tree->process(0);
+		}
+		CHECK(bool(tree->get_automatic_thread_groups()[0].get("checking")));
+
+		tree->physics_process(0);
+		tree->process(0);
+		groups = tree->get_automatic_thread_groups();
+		CHECK_FALSE(bool(groups[0].get("checking")));
+		CHECK(bool(groups[0].get("threaded")));
+	}
+
+	SUBCASE("Calls into other nodes from a sub-thread are deferred to their thread group") {
+		for (uint32_t i = 0; i < SceneTree::AUTOMATIC_THREAD_GROUP_CHECK_FRAMES; i++) {
+			tree->process(0);
+		}
+		REQUIRE(bool(tree->get_automatic_thread_groups()[0].get("threaded")));
+
+		node->call_target = outside;
+		ERR_PRINT_OFF;
+		tree->process(0);
+		node->call_target = nullptr;
+		tree->process(0);
+		ERR_PRINT_ON;
+
+		CHECK_EQ(outside->get_process_priority(), 7);
+		groups = tree->get_automatic_thread_groups();
+		CHECK_FALSE(bool(groups[0].get("threaded")));
+		CHECK(String(groups[0].get("reason")).contains("set_process_priority"));
+	}
+
+	SUBCASE("Calls with a result into other nodes from a sub-thread fail") {
+		for (uint32_t i = 0; i < SceneTree::AUTOMATIC_THREAD_GROUP_CHECK_FRAMES; i++) {
+			tree->process(0);
+		}
+		REQUIRE(bool(tree->get_automatic_thread_groups()[0].get("threaded")));
+
+		outside->set_process_priority(3);
+		node->result_target = outside;
+		ERR_PRINT_OFF;
+		tree->process(0);
+		ERR_PRINT_ON;
+		CHECK_EQ(node->result_error, Callable::CallError::CALL_ERROR_INVALID_METHOD);
+		CHECK_EQ(node->result, Variant());
+
+		// Moved back to the main thread, where the call succeeds.
+		groups = tree->get_automatic_thread_groups();
+		CHECK_FALSE(bool(groups[0].get("threaded")));
+		CHECK(String(groups[0].get("reason")).contains("get_process_priority"));
+		tree->process(0);
+		CHECK_EQ(node->result_error, Callable::CallError::CALL_OK);
+		CHECK_EQ(node->result, Variant(3));
+	}
+
+	SUBCASE("Thread groups accessing other nodes stay on the main thread") {
+		node->other = outside;
+		ERR_PRINT_OFF;
+		tree->process(0);
+		ERR_PRINT_ON;
+
+		groups = tree->get_automatic_thread_groups();
+		CHECK_FALSE(bool(groups[0].get("checking")));
+		CHECK_FALSE(bool(groups[0].get("threaded")));
+		CHECK(String(groups[0].get("reason")).contains("set_process_priority"));
+
+		// The access is still allowed, as it happens on the main thread.
+		for (uint32_t i = 0; i < SceneTree::AUTOMATIC_THREAD_GROUP_CHECK_FRAMES; i++) {
+			tree->process(0);
+		}
+		CHECK_FALSE(bool(tree->get_automatic_thread_groups()[0].get("threaded")));
+	}
+
+	memdelete(group_owner);
+	memdelete(outside);
+	CHECK(tree->get_automatic_thread_groups().is_empty());
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[SceneTree][Node] Groups and process lists when a subtree enters and exits the tree") {
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	TestNode *kept = memnew(TestNode);
+	kept->add_to_group("units");
+	kept->set_process(true);
+	root->add_child(kept);
+
+	Node *chunk = memnew(Node);
+	LocalVector<TestNode *> chunk_nodes;
+	for (int i = 0; i < 10; i++) {
+		TestNode *node = memnew(TestNode);
+		node->add_to_group("units");
+		node->add_to_group("chunk");
+		node->set_process(true);
+		chunk->add_child(node);
+		chunk_nodes.push_back(node);
+	}
+
+	root->add_child(chunk);
+	CHECK(SceneTree::get_singleton()->has_group("chunk"));
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("units"), 11);
+
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(kept->process_counter, 1);
+	for (TestNode *node : chunk_nodes) {
+		CHECK_EQ(node->process_counter, 1);
+	}
+
+	root->remove_child(chunk);
+	CHECK_FALSE(SceneTree::get_singleton()->has_group("chunk"));
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("units"), 1);
+	CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("units"), kept);
+
+	SceneTree::get_singleton()->process(0);
+	CHECK_EQ(kept->process_counter, 2);
+	for (TestNode *node : chunk_nodes) {
+		CHECK_EQ(node->process_counter, 1);
+	}
+
+	// Entering the tree again registers the subtree again.
+	root->add_child(chunk);
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("units"), 11);
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("chunk"), 10);
+
+	memdelete(chunk);
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("units"), 1);
+
+	memdelete(kept);
+	CHECK_FALSE(SceneTree::get_singleton()->has_group("units"));
+}
+
+TEST_CASE("[SceneTree][Node] Node path cache") {
+	Node *scene = memnew(Node);
+	scene->set_name("Scene");
+	Node *hud = memnew(Node);
+	hud->set_name("HUD");
+	scene->add_child(hud);
+	hud->set_owner(scene);
+	Node *label = memnew(Node);
+	label->set_name("Label");
+	hud->add_child(label);
+	label->set_owner(scene);
+	Node *sibling = memnew(Node);
+	sibling->set_name("Sibling");
+	scene->add_child(sibling);
+	sibling->set_owner(scene);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	sibling->set_cache_node_paths(true);
+	CHECK(sibling->is_caching_node_paths());
+	CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), label);
+	CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), label);
+
+	SUBCASE("Renaming a node on the path invalidates the result") {
+		hud->set_name("Overlay");
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), nullptr);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../Overlay/Label")), label);
+		hud->set_name("HUD");
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), label);
+	}
+
+	SUBCASE("Removing and adding nodes invalidates the result") {
+		hud->remove_child(label);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), nullptr);
+
+		Node *other = memnew(Node);
+		other->set_name("Label");
+		hud->add_child(other);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), other);
+
+		memdelete(other);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), nullptr);
+		hud->add_child(label);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), label);
+	}
+
+	SUBCASE("Moving the node itself invalidates relative paths") {
+		scene->remove_child(sibling);
+		hud->add_child(sibling);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), nullptr);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../Label")), label);
+		hud->remove_child(sibling);
+		scene->add_child(sibling);
+		sibling->set_owner(scene);
+	}
+
+	SUBCASE("Paths leaving a detached node are resolved once it has a parent") {
+		Node *detached = memnew(Node);
+		detached->set_cache_node_paths(true);
+		CHECK_EQ(detached->get_node_or_null(NodePath("..")), nullptr);
+		hud->add_child(detached);
+		CHECK_EQ(detached->get_node_or_null(NodePath("..")), hud);
+		CHECK_EQ(detached->get_node_or_null(NodePath("../Label")), label);
+		hud->remove_child(detached);
+		CHECK_EQ(detached->get_node_or_null(NodePath("..")), nullptr);
+		memdelete(detached);
+	}
+
+	SUBCASE("Unique names resolved through the owner") {
+		CHECK_EQ(sibling->get_node_or_null(NodePath("%Label")), nullptr);
+		label->set_unique_name_in_owner(true);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("%Label")), label);
+		label->set_name("Title");
+		CHECK_EQ(sibling->get_node_or_null(NodePath("%Label")), nullptr);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("%Title")), label);
+		label->set_unique_name_in_owner(false);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("%Title")), nullptr);
+		label->set_name("Label");
+	}
+
+	SUBCASE("Absolute paths") {
+		CHECK_EQ(sibling->get_node_or_null(NodePath("/root/Scene/HUD/Label")), label);
+		scene->set_name("Level");
+		CHECK_EQ(sibling->get_node_or_null(NodePath("/root/Scene/HUD/Label")), nullptr);
+		CHECK_EQ(sibling->get_node_or_null(NodePath("/root/Level/HUD/Label")), label);
+		scene->set_name("Scene");
+	}
+
+	SUBCASE("Freed targets are not returned") {
+		memdelete(label);
+		label = nullptr;
+		CHECK_EQ(sibling->get_node_or_null(NodePath("../HUD/Label")), nullptr);
+	}
+
+	sibling->set_cache_node_paths(false);
+	CHECK_FALSE(sibling->is_caching_node_paths());
+	memdelete(scene);
+}
+
 } // namespace TestNode
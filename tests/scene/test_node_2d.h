@@ -32,6 +32,7 @@
 
 #include "scene/2d/node_2d.h"
 #include "scene/main/window.h"
+#include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
 
@@ -210,4 +211,47 @@ TEST_CASE("[SceneTree][Node2D] Utility methods") {
 	memdelete(test_node1);
 }
 
+TEST_CASE("[SceneTree][Node2D] Duplicate") {
+	Node2D *node = memnew(Node2D);
+	node->set_name("Node");
+	node->set_position(Point2(10, 20));
+	node->set_rotation(0.5);
+	node->set_scale(Size2(2, 3));
+	node->set_skew(0.25);
+	node->set_modulate(Color(1, 0, 0));
+	node->set_z_index(3);
+	node->set_light_mask(5);
+	node->set_texture_filter(CanvasItem::TEXTURE_FILTER_NEAREST);
+	node->set_process_mode(Node::PROCESS_MODE_ALWAYS);
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Point2(1, 1));
+	node->add_child(child);
+
+	SUBCASE("Properties are copied") {
+		Node2D *copy = Object::cast_to<Node2D>(node->duplicate());
+		REQUIRE(copy);
+
+		List<PropertyInfo> props;
+		node->get_property_list(&props);
+		for (const PropertyInfo &E : props) {
+			if (E.usage & PROPERTY_USAGE_STORAGE) {
+				CHECK_MESSAGE(copy->get(E.name) == node->get(E.name), vformat("Property \"%s\" was not duplicated.", E.name));
+			}
+		}
+		CHECK_EQ(Object::cast_to<Node2D>(copy->get_child(0))->get_position(), Point2(1, 1));
+		memdelete(copy);
+	}
+
+	SUBCASE("Node references are remapped") {
+		node->set_meta("target", child);
+		Node2D *copy = Object::cast_to<Node2D>(node->duplicate());
+		REQUIRE(copy);
+		CHECK_EQ(Object::cast_to<Node>(copy->get_meta("target")), copy->get_child(0));
+		memdelete(copy);
+	}
+
+	memdelete(node);
+}
+
 } // namespace TestNode2D
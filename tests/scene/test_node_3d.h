@@ -0,0 +1,214 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifyNode3D : public Node3D {
+	GDCLASS(TransformNotifyNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+			if (move_on_notification) {
+				Node3D *node = move_on_notification;
+				move_on_notification = nullptr;
+				node->set_position(node->get_position() + Vector3(1, 0, 0));
+			}
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+	Node3D *move_on_notification = nullptr;
+
+	void ignore_transform_notification(bool p_ignore) {
+		set_ignore_transform_notification(p_ignore);
+	}
+
+	TransformNotifyNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform change notifications") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node3D *parent = memnew(Node3D);
+	TransformNotifyNode3D *child = memnew(TransformNotifyNode3D);
+	TransformNotifyNode3D *grandchild = memnew(TransformNotifyNode3D);
+	parent->add_child(child);
+	child->add_child(grandchild);
+	tree->get_root()->add_child(parent);
+
+	tree->flush_transform_notifications();
+	child->transform_changed_count = 0;
+	grandchild->transform_changed_count = 0;
+
+	SUBCASE("Repeated changes within a frame notify once") {
+		parent->set_position(Vector3(1, 0, 0));
+		child->set_position(Vector3(0, 1, 0));
+		parent->set_position(Vector3(2, 0, 0));
+		grandchild->set_position(Vector3(0, 0, 1));
+		parent->set_position(Vector3(3, 0, 0));
+		child->set_position(Vector3(0, 2, 0));
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 1);
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+		CHECK_EQ(grandchild->get_global_position(), Vector3(3, 2, 1));
+
+		parent->set_position(Vector3(4, 0, 0));
+		parent->set_position(Vector3(5, 0, 0));
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 2);
+		CHECK_EQ(grandchild->transform_changed_count, 2);
+		CHECK_EQ(grandchild->get_global_position(), Vector3(5, 2, 1));
+	}
+
+	SUBCASE("Changes with notifications ignored do not hide later changes") {
+		grandchild->ignore_transform_notification(true);
+		grandchild->set_position(Vector3(0, 0, 1));
+		grandchild->ignore_transform_notification(false);
+		parent->set_position(Vector3(1, 0, 0));
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 1);
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+		CHECK_EQ(grandchild->get_global_position(), Vector3(1, 0, 1));
+	}
+
+	SUBCASE("Forced updates do not hide later changes") {
+		parent->set_position(Vector3(1, 0, 0));
+		grandchild->force_update_transform();
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+
+		parent->set_position(Vector3(2, 0, 0));
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 1);
+		CHECK_EQ(grandchild->transform_changed_count, 2);
+		CHECK_EQ(grandchild->get_global_position(), Vector3(2, 0, 0));
+	}
+
+	SUBCASE("Enabling notifications does not miss pending changes") {
+		grandchild->set_notify_transform(false);
+		parent->set_position(Vector3(1, 0, 0));
+		grandchild->set_notify_transform(true);
+		parent->set_position(Vector3(2, 0, 0));
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 1);
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+	}
+
+	SUBCASE("Changes made by notification handlers during the flush are not missed") {
+		parent->set_position(Vector3(1, 0, 0));
+		child->move_on_notification = parent;
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 1);
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+
+		// The child was already notified when its handler moved the parent, so it is queued again
+		// for the next flush. The grandchild was still queued and notified after the move.
+		tree->flush_transform_notifications();
+
+		CHECK_EQ(child->transform_changed_count, 2);
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+		CHECK_EQ(grandchild->get_global_position(), Vector3(2, 0, 0));
+	}
+
+	SUBCASE("Top level nodes are not notified of parent changes") {
+		grandchild->set_as_top_level(true);
+		tree->flush_transform_notifications();
+		grandchild->transform_changed_count = 0;
+
+		parent->set_position(Vector3(1, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK_EQ(grandchild->transform_changed_count, 0);
+
+		grandchild->set_as_top_level(false);
+		tree->flush_transform_notifications();
+		grandchild->transform_changed_count = 0;
+
+		parent->set_position(Vector3(2, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK_EQ(grandchild->transform_changed_count, 1);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node3D] Duplicate") {
+	Node3D *node = memnew(Node3D);
+	node->set_name("Node");
+	node->set_transform(Transform3D(Basis::from_euler(Vector3(0.1, 0.2, 0.3)), Vector3(1, 2, 3)));
+	node->set_rotation_edit_mode(Node3D::ROTATION_EDIT_MODE_QUATERNION);
+	node->set_as_top_level(true);
+	node->set_visible(false);
+	node->set_visibility_parent(NodePath("../Other"));
+	node->set_process_priority(4);
+	node->set_editor_description("Duplicated natively.");
+	node->set_meta("speed", 10);
+	Node3D *child = memnew(Node3D);
+	child->set_name("Child");
+	child->set_position(Vector3(4, 5, 6));
+	node->add_child(child);
+
+	Node3D *copy = Object::cast_to<Node3D>(node->duplicate());
+	REQUIRE(copy);
+	REQUIRE_EQ(copy->get_child_count(), 1);
+
+	// The copy must end up in the same state as with the property list.
+	List<PropertyInfo> props;
+	node->get_property_list(&props);
+	for (const PropertyInfo &E : props) {
+		if (E.usage & PROPERTY_USAGE_STORAGE) {
+			CHECK_MESSAGE(copy->get(E.name) == node->get(E.name), vformat("Property \"%s\" was not duplicated.", E.name));
+		}
+	}
+	CHECK(copy->get_transform().is_equal_approx(node->get_transform()));
+	CHECK_FALSE(copy->is_visible());
+	CHECK_EQ(Object::cast_to<Node3D>(copy->get_child(0))->get_position(), Vector3(4, 5, 6));
+
+	memdelete(copy);
+	memdelete(node);
+}
+
+} // namespace TestNode3D
@@ -30,6 +30,11 @@
 
 #pragma once
 
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/canvas_item_material.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -280,4 +285,184 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Instantiate properties, groups and connections") {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Root");
+	root->set_position(Vector2(3, 4));
+	root->set_z_index(2);
+	root->add_to_group("enemies", true);
+
+	Control *control = memnew(Control);
+	control->set_name("Control");
+	control->set_anchor(SIDE_RIGHT, 0.5);
+	control->set_editor_description("Packed");
+	root->add_child(control);
+	control->set_owner(root);
+
+	root->connect(SNAME("renamed"), Callable(control, "set_editor_description").bind("Renamed"), Object::CONNECT_PERSIST);
+
+	PackedScene packed_scene;
+	CHECK(packed_scene.pack(root) == OK);
+	memdelete(root);
+
+	// The second instance reuses the instantiation plan compiled by the first one.
+	for (int i = 0; i < 2; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance);
+		CHECK(instance->get_position() == Vector2(3, 4));
+		CHECK(instance->get_z_index() == 2);
+		CHECK(instance->is_in_group("enemies"));
+
+		Control *instance_control = Object::cast_to<Control>(instance->get_node(NodePath("Control")));
+		REQUIRE(instance_control);
+		CHECK(instance_control->get_anchor(SIDE_RIGHT) == doctest::Approx(0.5));
+		CHECK(instance_control->get_editor_description() == "Packed");
+
+		instance->emit_signal(SNAME("renamed"));
+		CHECK(instance_control->get_editor_description() == "Renamed");
+
+		memdelete(instance);
+	}
+}
+
+static Ref<PackedScene> _make_pooled_test_scene() {
+	// root
+	// `- child
+	Node2D *root = memnew(Node2D);
+	root->set_name("Root");
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(1, 2));
+	root->add_child(child);
+	child->set_owner(root);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_CASE("[PackedScene] Instance pool") {
+	Ref<PackedScene> packed_scene = _make_pooled_test_scene();
+
+	SUBCASE("Released instances are reused and reset to the packed state") {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate_pooled());
+		REQUIRE(instance);
+		CHECK(packed_scene->get_pooled_count() == 0);
+
+		Node2D *child = Object::cast_to<Node2D>(instance->get_node(NodePath("Child")));
+		REQUIRE(child);
+		instance->set_position(Vector2(10, 20));
+		instance->set_visible(false);
+		child->set_position(Vector2(30, 40));
+		instance->add_to_group("runtime_group");
+
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_pooled_count() == 1);
+
+		Node2D *reused = Object::cast_to<Node2D>(packed_scene->instantiate_pooled());
+		CHECK(reused == instance);
+		CHECK(packed_scene->get_pooled_count() == 0);
+		CHECK(reused->get_position() == Vector2());
+		CHECK(reused->is_visible());
+		CHECK(child->get_position() == Vector2(1, 2));
+
+		memdelete(reused);
+	}
+
+	SUBCASE("Connections to nodes outside of the instance are removed") {
+		Node *outside = memnew(Node);
+		Node *instance = packed_scene->instantiate_pooled();
+		REQUIRE(instance);
+		Node *child = instance->get_node(NodePath("Child"));
+
+		const Callable outside_callable = callable_mp(outside, &Node::queue_free);
+		const Callable inside_callable = callable_mp(child, &Node::queue_free);
+		instance->connect(SNAME("renamed"), outside_callable);
+		instance->connect(SNAME("renamed"), inside_callable);
+		outside->connect(SNAME("renamed"), callable_mp(instance, &Node::queue_free));
+
+		packed_scene->release_instance(instance);
+		CHECK_FALSE(instance->is_connected(SNAME("renamed"), outside_callable));
+		CHECK(instance->is_connected(SNAME("renamed"), inside_callable));
+		CHECK_FALSE(outside->is_connected(SNAME("renamed"), callable_mp(instance, &Node::queue_free)));
+
+		memdelete(outside);
+	}
+
+	SUBCASE("Resources local to the scene are duplicated again") {
+		Node2D *root = memnew(Node2D);
+		Ref<CanvasItemMaterial> material;
+		material.instantiate();
+		material->set_local_to_scene(true);
+		root->set_material(material);
+		Ref<PackedScene> local_scene;
+		local_scene.instantiate();
+		local_scene->pack(root);
+		memdelete(root);
+
+		Node2D *instance = Object::cast_to<Node2D>(local_scene->instantiate_pooled());
+		REQUIRE(instance);
+		Ref<CanvasItemMaterial> used_material = instance->get_material();
+		REQUIRE(used_material.is_valid());
+		CHECK(used_material != material);
+		used_material->set_blend_mode(CanvasItemMaterial::BLEND_MODE_ADD);
+
+		local_scene->release_instance(instance);
+		Node2D *reused = Object::cast_to<Node2D>(local_scene->instantiate_pooled());
+		CHECK(reused == instance);
+		Ref<CanvasItemMaterial> reused_material = reused->get_material();
+		REQUIRE(reused_material.is_valid());
+		CHECK(reused_material != used_material);
+		CHECK(reused_material->get_blend_mode() == CanvasItemMaterial::BLEND_MODE_MIX);
+		CHECK(reused_material->is_local_to_scene());
+		CHECK(reused_material->get_local_scene() == reused);
+
+		memdelete(reused);
+	}
+
+	SUBCASE("Instances with a changed node structure are not pooled") {
+		Node *instance = packed_scene->instantiate_pooled();
+		REQUIRE(instance);
+		instance->add_child(memnew(Node));
+
+		packed_scene->release_instance(instance);
+		CHECK(packed_scene->get_pooled_count() == 0);
+	}
+
+	SUBCASE("Prewarming fills the pool up to its maximum size") {
+		packed_scene->set_pool_max_size(8);
+		packed_scene->prewarm(5);
+		CHECK(packed_scene->get_pooled_count() == 5);
+		packed_scene->prewarm(5);
+		CHECK(packed_scene->get_pooled_count() == 8);
+
+		Node *instance = packed_scene->instantiate_pooled();
+		REQUIRE(instance);
+		CHECK(instance->get_node_or_null(NodePath("Child")) != nullptr);
+		CHECK(packed_scene->get_pooled_count() == 7);
+		memdelete(instance);
+
+		packed_scene->set_pool_max_size(2);
+		CHECK(packed_scene->get_pooled_count() == 2);
+		packed_scene->clear_pool();
+		CHECK(packed_scene->get_pooled_count() == 0);
+	}
+
+	SUBCASE("Nodes from other scenes are rejected") {
+		Ref<PackedScene> other_scene = _make_pooled_test_scene();
+		other_scene->set_path("res://other_scene.tscn", true);
+		Node *instance = other_scene->instantiate();
+
+		packed_scene->set_path("res://pooled_scene.tscn", true);
+		ERR_PRINT_OFF;
+		packed_scene->release_instance(instance);
+		ERR_PRINT_ON;
+		CHECK(packed_scene->get_pooled_count() == 0);
+
+		memdelete(instance);
+	}
+}
+
 } // namespace TestPackedScene
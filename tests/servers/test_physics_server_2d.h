@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_physics_server_2d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "servers/physics_server_2d.h"
+
+#include "tests/servers/physics_server_test_utils.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer2D {
+
+// A static floor with rows of slightly overlapping dynamic boxes dropped on it,
+// so that the boxes end up resting on and pushing against each other.
+static void create_box_pile(RID p_space, RID p_floor_shape, RID p_box_shape, int p_count, LocalVector<RID> &r_bodies) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, p_floor_shape);
+	ps->body_set_state(floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0, 100)));
+	ps->body_set_space(floor, p_space);
+	r_bodies.push_back(floor);
+
+	const int side = Math::ceil(Math::sqrt((double)p_count));
+	for (int i = 0; i < p_count; i++) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer2D::BODY_MODE_RIGID);
+		ps->body_add_shape(body, p_box_shape);
+		const Vector2 origin = Vector2((i % side) * 19 - side * 10, 80 - (i / side) * 19 - (i % 3) * 5);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(i * 0.1, origin));
+		ps->body_set_space(body, p_space);
+		r_bodies.push_back(body);
+	}
+}
+
+// Transforms and velocities of the bodies, which is what a resimulation needs to reproduce.
+// Full states aren't compared, as the broad phase may keep extra pairs without contacts around.
+static LocalVector<Variant> get_body_states(const LocalVector<RID> &p_bodies) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	LocalVector<Variant> states;
+	for (const RID &body : p_bodies) {
+		states.push_back(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM));
+		states.push_back(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY));
+		states.push_back(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY));
+		states.push_back(ps->body_get_state(body, PhysicsServer2D::BODY_STATE_SLEEPING));
+	}
+	return states;
+}
+
+// Creates spaces in deterministic mode for the duration of the scope.
+struct DeterministicSpaces {
+	DeterministicSpaces() {
+		ProjectSettings::get_singleton()->set_setting("physics/2d/solver/deterministic", true);
+	}
+	~DeterministicSpaces() {
+		ProjectSettings::get_singleton()->set_setting("physics/2d/solver/deterministic", false);
+	}
+};
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Space state snapshots") {
+	constexpr int BODY_COUNT = 200;
+	constexpr int STEP_COUNT = 30;
+
+	DeterministicSpaces deterministic;
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(floor_shape, Vector2(1000, 10));
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(10, 10));
+	LocalVector<RID> bodies;
+	create_box_pile(space, floor_shape, box_shape, BODY_COUNT, bodies);
+
+	// Let the boxes settle into contact first, so that cached contacts are part of the state.
+	TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+	const Vector<uint8_t> initial_state = ps->space_save_state(space);
+	REQUIRE_FALSE(initial_state.is_empty());
+	const LocalVector<Variant> initial_body_states = get_body_states(bodies);
+
+	SUBCASE("Restoring a state moves bodies back") {
+		ps->step(1.0 / 60.0);
+		CHECK_FALSE(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), initial_body_states));
+		CHECK_EQ(ps->space_restore_state(space, initial_state), OK);
+		CHECK(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), initial_body_states));
+	}
+
+	SUBCASE("Resimulating from a state is reproducible") {
+		LocalVector<LocalVector<Variant>> states;
+		for (int i = 0; i < STEP_COUNT; i++) {
+			ps->step(1.0 / 60.0);
+			states.push_back(get_body_states(bodies));
+		}
+
+		REQUIRE_EQ(ps->space_restore_state(space, initial_state), OK);
+		for (int i = 0; i < STEP_COUNT; i++) {
+			ps->step(1.0 / 60.0);
+			CHECK_MESSAGE(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), states[i]), vformat("Step %d differs after restoring.", i));
+		}
+	}
+
+	SUBCASE("Invalid states are rejected") {
+		ERR_PRINT_OFF;
+		CHECK_EQ(ps->space_restore_state(space, Vector<uint8_t>()), ERR_INVALID_DATA);
+		Vector<uint8_t> truncated = initial_state;
+		truncated.resize(truncated.size() / 2);
+		CHECK_EQ(ps->space_restore_state(space, truncated), ERR_INVALID_DATA);
+		ERR_PRINT_ON;
+	}
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+} // namespace TestPhysicsServer2D
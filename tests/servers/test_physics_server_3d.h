@@ -0,0 +1,614 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/physics_server_3d.h"
+#include "servers/rendering_server.h"
+
+#include "tests/servers/physics_server_test_utils.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+static RID create_body(RID p_space, RID p_shape, PhysicsServer3D::BodyMode p_mode, const Transform3D &p_transform = Transform3D()) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID body = ps->body_create();
+	ps->body_set_mode(body, p_mode);
+	ps->body_add_shape(body, p_shape);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+	ps->body_set_space(body, p_space);
+	return body;
+}
+
+static RID create_static_body(RID p_space, RID p_shape, const Transform3D &p_transform = Transform3D()) {
+	return create_body(p_space, p_shape, PhysicsServer3D::BODY_MODE_STATIC, p_transform);
+}
+
+static RID create_rigid_body(RID p_space, RID p_shape, const Transform3D &p_transform = Transform3D()) {
+	return create_body(p_space, p_shape, PhysicsServer3D::BODY_MODE_RIGID, p_transform);
+}
+
+// A row of static boxes along the X axis, one every 4 meters.
+static void create_box_row(RID p_space, RID p_shape, int p_count, LocalVector<RID> &r_bodies) {
+	for (int i = 0; i < p_count; i++) {
+		r_bodies.push_back(create_static_body(p_space, p_shape, Transform3D(Basis(), Vector3(i * 4, 0, 0))));
+	}
+}
+
+// A static floor with a square grid of slightly overlapping dynamic boxes dropped on it,
+// so that neighboring boxes get paired by the broad phase.
+static void create_box_pile(RID p_space, RID p_floor_shape, RID p_box_shape, int p_count, LocalVector<RID> &r_bodies) {
+	r_bodies.push_back(create_static_body(p_space, p_floor_shape));
+
+	const int side = Math::ceil(Math::sqrt((double)p_count));
+	for (int i = 0; i < p_count; i++) {
+		const Vector3 origin = Vector3((i % side) * 1.9 - side, 2 + (i % 3) * 0.5, (i / side) * 1.9 - side);
+		r_bodies.push_back(create_rigid_body(p_space, p_box_shape, Transform3D(Basis(), origin)));
+	}
+}
+
+// Transforms and velocities of the bodies, to check that restoring a state puts them back.
+static LocalVector<Variant> get_body_states(const LocalVector<RID> &p_bodies) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	LocalVector<Variant> states;
+	for (const RID &body : p_bodies) {
+		states.push_back(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM));
+		states.push_back(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY));
+		states.push_back(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY));
+		states.push_back(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_SLEEPING));
+	}
+	return states;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched queries match single queries") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID shape = ps->box_shape_create();
+	ps->shape_set_data(shape, Vector3(1, 1, 1));
+	LocalVector<RID> bodies;
+	create_box_row(space, shape, 10, bodies);
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	REQUIRE(state);
+
+	// Enough rays to be split across worker threads, every other one missing the boxes.
+	constexpr int RAY_COUNT = 500;
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	for (int i = 0; i < RAY_COUNT; i++) {
+		const real_t x = (i % 40) + 0.1;
+		from.push_back(Vector3(x, 10, (i % 2) * 5));
+		to.push_back(Vector3(x, -10, (i % 2) * 5));
+	}
+
+	SUBCASE("Rays") {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+		results.resize(RAY_COUNT);
+		LocalVector<bool> hits;
+		hits.resize(RAY_COUNT);
+		state->intersect_rays(parameters, from.ptr(), to.ptr(), RAY_COUNT, results.ptr(), hits.ptr());
+
+		int hit_count = 0;
+		for (int i = 0; i < RAY_COUNT; i++) {
+			parameters.from = from[i];
+			parameters.to = to[i];
+			PhysicsDirectSpaceState3D::RayResult result;
+			const bool hit = state->intersect_ray(parameters, result);
+			CHECK_EQ(hits[i], hit);
+			if (hit && hits[i]) {
+				CHECK(results[i].position.is_equal_approx(result.position));
+				CHECK_EQ(results[i].rid, result.rid);
+				hit_count++;
+			}
+		}
+		CHECK(hit_count > 0);
+		CHECK(hit_count < RAY_COUNT);
+	}
+
+	SUBCASE("Shapes") {
+		RID query_shape = ps->sphere_shape_create();
+		ps->shape_set_data(query_shape, 0.5);
+		PhysicsDirectSpaceState3D::ShapeParameters parameters;
+		parameters.shape_rid = query_shape;
+
+		constexpr int RESULT_MAX = 4;
+		LocalVector<Transform3D> transforms;
+		for (int i = 0; i < RAY_COUNT; i++) {
+			transforms.push_back(Transform3D(Basis(), from[i] * Vector3(1, 0, 1)));
+		}
+		LocalVector<PhysicsDirectSpaceState3D::ShapeResult> results;
+		results.resize(RAY_COUNT * RESULT_MAX);
+		LocalVector<int> result_counts;
+		result_counts.resize(RAY_COUNT);
+		state->intersect_shapes(parameters, transforms.ptr(), RAY_COUNT, results.ptr(), RESULT_MAX, result_counts.ptr());
+
+		for (int i = 0; i < RAY_COUNT; i++) {
+			parameters.transform = transforms[i];
+			PhysicsDirectSpaceState3D::ShapeResult single_results[RESULT_MAX];
+			const int count = state->intersect_shape(parameters, single_results, RESULT_MAX);
+			CHECK_EQ(result_counts[i], count);
+			if (count > 0 && result_counts[i] > 0) {
+				CHECK_EQ(results[i * RESULT_MAX].rid, single_results[0].rid);
+			}
+		}
+		ps->free(query_shape);
+	}
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Stepping is reproducible") {
+	// Enough bodies for the broad phase to find pairs on worker threads.
+	constexpr int BODY_COUNT = 400;
+	constexpr int STEP_COUNT = 30;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(100, 1, 100));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+
+	LocalVector<Transform3D> transforms[2];
+	for (int run = 0; run < 2; run++) {
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+		LocalVector<RID> bodies;
+		create_box_pile(space, floor_shape, box_shape, BODY_COUNT, bodies);
+
+		TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+
+		for (const RID &body : bodies) {
+			transforms[run].push_back(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM));
+			ps->free(body);
+		}
+		ps->free(space);
+	}
+
+	REQUIRE_EQ(transforms[0].size(), transforms[1].size());
+	for (uint32_t i = 0; i < transforms[0].size(); i++) {
+		CHECK_EQ(transforms[0][i], transforms[1][i]);
+	}
+
+	ps->free(box_shape);
+	ps->free(floor_shape);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Space state snapshots") {
+	constexpr int BODY_COUNT = 100;
+	constexpr int STEP_COUNT = 30;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(100, 1, 100));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+	LocalVector<RID> bodies;
+	create_box_pile(space, floor_shape, box_shape, BODY_COUNT, bodies);
+
+	// Let the boxes land first, so that cached contacts are part of the state.
+	TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+	const Vector<uint8_t> initial_state = ps->space_save_state(space);
+	REQUIRE_FALSE(initial_state.is_empty());
+	const LocalVector<Variant> initial_body_states = get_body_states(bodies);
+
+	SUBCASE("Restoring a state moves bodies back") {
+		TestPhysicsServerUtils::step_spaces(ps, 10);
+		CHECK_FALSE(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), initial_body_states));
+		CHECK_EQ(ps->space_restore_state(space, initial_state), OK);
+		CHECK(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), initial_body_states));
+	}
+
+	SUBCASE("Restoring a state keeps bodies added since") {
+		RID body = create_rigid_body(space, box_shape, Transform3D(Basis(), Vector3(0, 50, 0)));
+		ps->step(1.0 / 60.0);
+		const Variant transform = ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+
+		CHECK_EQ(ps->space_restore_state(space, initial_state), OK);
+		CHECK(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), initial_body_states));
+		CHECK_EQ(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM), transform);
+		ps->free(body);
+	}
+
+	SUBCASE("Invalid states are rejected") {
+		ERR_PRINT_OFF;
+		CHECK_EQ(ps->space_restore_state(space, Vector<uint8_t>()), ERR_INVALID_DATA);
+		Vector<uint8_t> truncated = initial_state;
+		truncated.resize(truncated.size() / 2);
+		CHECK_EQ(ps->space_restore_state(space, truncated), ERR_INVALID_DATA);
+		ERR_PRINT_ON;
+	}
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Active regions") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+
+	// Two falling boxes, one near the origin and one far away from it.
+	RID near_body = create_rigid_body(space, box_shape, Transform3D(Basis(), Vector3(0, 10, 0)));
+	RID far_body = create_rigid_body(space, box_shape, Transform3D(Basis(), Vector3(1000, 10, 0)));
+
+	Vector<AABB> regions;
+	regions.push_back(AABB(Vector3(-50, -50, -50), Vector3(100, 100, 100)));
+	ps->space_set_active_regions(space, regions);
+	ps->step(1.0 / 60.0);
+
+	// The far body is suspended after the first step.
+	const Vector3 near_origin = Transform3D(ps->body_get_state(near_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin;
+	const Vector3 far_origin = Transform3D(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin;
+	CHECK(bool(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_SLEEPING)));
+	TestPhysicsServerUtils::step_spaces(ps, 10);
+	CHECK(Transform3D(ps->body_get_state(near_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.y < near_origin.y);
+	CHECK_EQ(Transform3D(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin, far_origin);
+
+	SUBCASE("Moving a region over a suspended body resumes it") {
+		regions.push_back(AABB(Vector3(950, -50, -50), Vector3(100, 100, 100)));
+		ps->space_set_active_regions(space, regions);
+		TestPhysicsServerUtils::step_spaces(ps, 10);
+		CHECK_FALSE(bool(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_SLEEPING)));
+		CHECK(Transform3D(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.y < far_origin.y);
+	}
+
+	SUBCASE("Clearing regions resumes suspended bodies") {
+		ps->space_set_active_regions(space, Vector<AABB>());
+		TestPhysicsServerUtils::step_spaces(ps, 10);
+		CHECK_FALSE(bool(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_SLEEPING)));
+		CHECK(Transform3D(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.y < far_origin.y);
+	}
+
+	SUBCASE("Waking up a suspended body simulates it again") {
+		ps->body_apply_central_impulse(far_body, Vector3(0, -1, 0));
+		ps->step(1.0 / 60.0);
+		CHECK(Transform3D(ps->body_get_state(far_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.y < far_origin.y);
+	}
+
+	ps->free(near_body);
+	ps->free(far_body);
+	ps->free(box_shape);
+	ps->free(space);
+}
+
+// A box flying at a constant velocity, unaffected by gravity.
+static RID create_projectile(RID p_space, RID p_shape, const Vector3 &p_origin, const Vector3 &p_velocity, bool p_continuous_cd) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID body = create_rigid_body(p_space, p_shape, Transform3D(Basis(), p_origin));
+	ps->body_set_param(body, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	ps->body_set_enable_continuous_collision_detection(body, p_continuous_cd);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, p_velocity);
+	return body;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Continuous collision detection") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	// Thin static obstacle at the origin, that a box moving 10 meters per step goes past in a single step.
+	RID obstacle_shape = ps->box_shape_create();
+	RID obstacle = create_static_body(space, obstacle_shape);
+
+	const Vector3 origin = Vector3(-5, 0, 0);
+	const Vector3 velocity = Vector3(300, 0, 0);
+
+	SUBCASE("Fast bodies go through thin walls without it") {
+		ps->shape_set_data(obstacle_shape, Vector3(0.025, 5, 5));
+		RID body = create_projectile(space, box_shape, origin, velocity, false);
+		for (int i = 0; i < 10; i++) {
+			ps->step(1.0 / 30.0);
+		}
+		CHECK(Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x > 0);
+		ps->free(body);
+	}
+
+	SUBCASE("Fast bodies are stopped by thin walls") {
+		ps->shape_set_data(obstacle_shape, Vector3(0.025, 5, 5));
+		RID body = create_projectile(space, box_shape, origin, velocity, true);
+		for (int i = 0; i < 10; i++) {
+			ps->step(1.0 / 30.0);
+		}
+		CHECK(Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x < 0);
+		ps->free(body);
+	}
+
+	SUBCASE("Fast bodies are stopped by thin poles") {
+		// The pole hits the middle of the box's face, away from its corners.
+		ps->shape_set_data(obstacle_shape, Vector3(0.025, 0.025, 5));
+		RID body = create_projectile(space, box_shape, origin, velocity, true);
+		for (int i = 0; i < 10; i++) {
+			ps->step(1.0 / 30.0);
+		}
+		CHECK(Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x < 0);
+		ps->free(body);
+	}
+
+	SUBCASE("Fast bodies keep their velocity until they hit") {
+		ps->shape_set_data(obstacle_shape, Vector3(0.025, 5, 5));
+		RID body = create_projectile(space, box_shape, origin, velocity, true);
+		ps->step(1.0 / 30.0);
+		CHECK(Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x < 0);
+		// Only slowed down by damping.
+		CHECK(Vector3(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY)).x > velocity.x * 0.9);
+		ps->free(body);
+	}
+
+	ps->free(obstacle);
+	ps->free(obstacle_shape);
+	ps->free(box_shape);
+	ps->free(space);
+}
+
+// Rolling hills with a flat area and a single tall spike, so the heightmap uses every kind of chunk storage.
+static real_t get_terrain_height(int p_x, int p_z) {
+	if (p_x < 32) {
+		return 0.0;
+	}
+	if (p_x == 40 && p_z == 3) {
+		return 1000.0;
+	}
+	return Math::sin(p_x * 0.3) * Math::cos(p_z * 0.2);
+}
+
+static Vector<real_t> create_terrain_heights(int p_width, int p_depth) {
+	Vector<real_t> heights;
+	heights.resize(p_width * p_depth);
+	real_t *w = heights.ptrw();
+	for (int z = 0; z < p_depth; z++) {
+		for (int x = 0; x < p_width; x++) {
+			w[z * p_width + x] = get_terrain_height(x, z);
+		}
+	}
+	return heights;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Compact heightmap and trimesh shapes") {
+	constexpr int SIZE = 100;
+	const Vector<real_t> heights = create_terrain_heights(SIZE, SIZE);
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	// Heightmaps are centered on their origin, move the trimesh and the expected points the same way.
+	const Vector3 offset = Vector3(-(SIZE - 1) * 0.5, 0, -(SIZE - 1) * 0.5);
+
+	RID shape;
+	SUBCASE("Heightmap") {
+		shape = ps->heightmap_shape_create();
+		Dictionary data;
+		data["width"] = SIZE;
+		data["depth"] = SIZE;
+		data["heights"] = heights;
+		ps->shape_set_data(shape, data);
+
+		// Heights only lose the precision the shape allows.
+		Dictionary stored = ps->shape_get_data(shape);
+		const Vector<real_t> stored_heights = stored["heights"];
+		REQUIRE_EQ(stored_heights.size(), heights.size());
+		for (int i = 0; i < heights.size(); i++) {
+			CHECK(Math::abs(stored_heights[i] - heights[i]) <= 0.001);
+		}
+	}
+
+	SUBCASE("Trimesh") {
+		shape = ps->concave_polygon_shape_create();
+		Vector<Vector3> faces;
+		for (int z = 0; z < SIZE - 1; z++) {
+			for (int x = 0; x < SIZE - 1; x++) {
+				const Vector3 p00 = offset + Vector3(x, get_terrain_height(x, z), z);
+				const Vector3 p10 = offset + Vector3(x + 1, get_terrain_height(x + 1, z), z);
+				const Vector3 p01 = offset + Vector3(x, get_terrain_height(x, z + 1), z + 1);
+				const Vector3 p11 = offset + Vector3(x + 1, get_terrain_height(x + 1, z + 1), z + 1);
+				faces.push_back(p00);
+				faces.push_back(p10);
+				faces.push_back(p01);
+				faces.push_back(p10);
+				faces.push_back(p11);
+				faces.push_back(p01);
+			}
+		}
+		Dictionary data;
+		data["faces"] = faces;
+		data["backface_collision"] = false;
+		ps->shape_set_data(shape, data);
+		CHECK_EQ(PackedVector3Array(ps->shape_get_data(shape).get("faces")).size(), faces.size());
+	}
+
+	RID body = create_static_body(space, shape);
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	REQUIRE(state);
+
+	// Rays long enough to go down the heightmap accelerator, descending faster than the hills so the first hit is the target.
+	RID query_shape = ps->sphere_shape_create();
+	ps->shape_set_data(query_shape, 0.5);
+	for (int z = 20; z < 60; z += 3) {
+		for (int x = 33; x < 60; x += 2) {
+			const Vector3 target = offset + Vector3(x, get_terrain_height(x, z), z);
+			PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+			ray_parameters.from = target + Vector3(40, 30, 25);
+			ray_parameters.to = target - Vector3(20, 15, 12.5);
+			PhysicsDirectSpaceState3D::RayResult result;
+			REQUIRE(state->intersect_ray(ray_parameters, result));
+			CHECK(result.position.distance_to(target) < 0.01);
+
+			// Spheres touching the ground and just above it.
+			PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+			shape_parameters.shape_rid = query_shape;
+			PhysicsDirectSpaceState3D::ShapeResult shape_result;
+			shape_parameters.transform = Transform3D(Basis(), target + Vector3(0, 0.4, 0));
+			CHECK_EQ(state->intersect_shape(shape_parameters, &shape_result, 1), 1);
+			shape_parameters.transform = Transform3D(Basis(), target + Vector3(0, 0.8, 0));
+			CHECK_EQ(state->intersect_shape(shape_parameters, &shape_result, 1), 0);
+		}
+	}
+
+	ps->free(query_shape);
+	ps->free(body);
+	ps->free(shape);
+	ps->free(space);
+}
+
+// A square cloth mesh of p_size x p_size vertices in the XZ plane, 10 centimeters apart.
+static RID create_cloth_mesh(int p_size) {
+	Vector<Vector3> vertices;
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			vertices.push_back(Vector3(x * 0.1, 0, z * 0.1));
+		}
+	}
+	Vector<int> indices;
+	for (int z = 0; z < p_size - 1; z++) {
+		for (int x = 0; x < p_size - 1; x++) {
+			const int i = z * p_size + x;
+			indices.push_back(i);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size + 1);
+			indices.push_back(i + p_size);
+		}
+	}
+
+	Array arrays;
+	arrays.resize(RS::ARRAY_MAX);
+	arrays[RS::ARRAY_VERTEX] = vertices;
+	arrays[RS::ARRAY_INDEX] = indices;
+	RID mesh = RS::get_singleton()->mesh_create();
+	RS::get_singleton()->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arrays);
+	return mesh;
+}
+
+// Cloths hanging from two corners, side by side along the X axis.
+static void create_cloths(RID p_space, RID p_mesh, int p_size, int p_count, LocalVector<RID> &r_bodies) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	for (int i = 0; i < p_count; i++) {
+		RID body = ps->soft_body_create();
+		ps->soft_body_pin_point(body, 0, true);
+		ps->soft_body_pin_point(body, p_size - 1, true);
+		ps->soft_body_set_mesh(body, p_mesh);
+		ps->soft_body_set_transform(body, Transform3D(Basis(), Vector3(i * p_size * 0.2, 0, 0)));
+		ps->soft_body_set_space(body, p_space);
+		r_bodies.push_back(body);
+	}
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Soft bodies on multiple threads") {
+	constexpr int CLOTH_SIZE = 16;
+	constexpr int CLOTH_COUNT = 8;
+	constexpr int STEP_COUNT = 30;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID mesh = create_cloth_mesh(CLOTH_SIZE);
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	LocalVector<RID> bodies;
+	create_cloths(space, mesh, CLOTH_SIZE, CLOTH_COUNT, bodies);
+
+	TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+
+	// Soft bodies are solved in parallel, each one on its own. They all move the same way,
+	// pinned corners stay in place while the rest of the cloth falls.
+	const Vector3 far_corner = ps->soft_body_get_point_global_position(bodies[0], CLOTH_SIZE * CLOTH_SIZE - 1);
+	CHECK(far_corner.y < -0.1);
+	for (uint32_t i = 0; i < bodies.size(); i++) {
+		const Vector3 offset(i * CLOTH_SIZE * 0.2, 0, 0);
+		CHECK_EQ(ps->soft_body_get_point_global_position(bodies[i], 0), offset);
+		CHECK(ps->soft_body_get_point_global_position(bodies[i], CLOTH_SIZE * CLOTH_SIZE - 1).is_equal_approx(far_corner + offset));
+	}
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(space);
+	RS::get_singleton()->free(mesh);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Per-phase process info") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(100, 1, 100));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+
+	RID busy_space = ps->space_create();
+	ps->space_set_active(busy_space, true);
+	RID empty_space = ps->space_create();
+	ps->space_set_active(empty_space, true);
+	LocalVector<RID> bodies;
+	create_box_pile(busy_space, floor_shape, box_shape, 400, bodies);
+
+	ps->step(1.0 / 60.0);
+	ps->flush_queries();
+
+	const PhysicsServer3D::ProcessInfo phases[] = {
+		PhysicsServer3D::INFO_BROAD_PHASE_TIME,
+		PhysicsServer3D::INFO_NARROW_PHASE_TIME,
+		PhysicsServer3D::INFO_SOLVER_TIME,
+		PhysicsServer3D::INFO_INTEGRATION_TIME,
+	};
+
+	int space_step_time = 0;
+	for (const RID &space : { busy_space, empty_space }) {
+		const int step_time = ps->space_get_process_info(space, PhysicsServer3D::INFO_STEP_TIME);
+		int phase_time = 0;
+		for (PhysicsServer3D::ProcessInfo phase : phases) {
+			CHECK_GE(ps->space_get_process_info(space, phase), 0);
+			phase_time += ps->space_get_process_info(space, phase);
+		}
+		CHECK_LE(phase_time, step_time);
+		CHECK_GE(ps->space_get_process_info(space, PhysicsServer3D::INFO_STATE_SYNC_TIME), 0);
+		CHECK_GE(ps->space_get_process_info(space, PhysicsServer3D::INFO_AREA_CALLBACK_TIME), 0);
+		space_step_time += step_time;
+	}
+
+	CHECK_GT(ps->space_get_process_info(busy_space, PhysicsServer3D::INFO_STEP_TIME), 0);
+	CHECK_EQ(ps->get_process_info(PhysicsServer3D::INFO_STEP_TIME), space_step_time);
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(empty_space);
+	ps->free(busy_space);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+}
+
+} // namespace TestPhysicsServer3D
@@ -0,0 +1,1054 @@
+/**************************************************************************/
+/*  test_benchmarks.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+// Benchmarks measure engine features on large workloads and report their timings with MESSAGE(),
+// instead of checking results like the other tests. They are all skipped by default, run them with
+// `--test-case="*Benchmark*" --no-skip`, or a narrower pattern such as `--test-case="*PhysicsServer3D][Benchmark*"`.
+//
+// Each benchmark is declared in the namespace of the tests of the same feature, to share their helpers.
+
+#include "scene/main/window.h"
+
+#include "tests/core/math/test_math_batch.h"
+#include "tests/core/object/test_object.h"
+#include "tests/core/variant/test_packed_array.h"
+#include "tests/scene/test_control.h"
+#include "tests/scene/test_node.h"
+#include "tests/scene/test_node_2d.h"
+#include "tests/scene/test_packed_scene.h"
+
+#ifndef PHYSICS_2D_DISABLED
+#include "tests/servers/test_physics_server_2d.h"
+#endif // PHYSICS_2D_DISABLED
+
+#ifndef _3D_DISABLED
+#include "tests/scene/test_node_3d.h"
+#ifndef PHYSICS_3D_DISABLED
+#include "tests/servers/test_physics_server_3d.h"
+#endif // PHYSICS_3D_DISABLED
+#endif // _3D_DISABLED
+
+#include "tests/test_macros.h"
+
+namespace TestMathBatch {
+
+TEST_CASE("[MathBatch][Benchmark] Batch kernels versus per-element operations" * doctest::skip()) {
+	constexpr uint32_t BENCH_COUNT = 100000;
+	RandomPCG rng(6);
+	const Transform3D xform = random_transform(rng);
+	LocalVector<Vector3> points;
+	LocalVector<Transform3D> xforms;
+	LocalVector<AABB> aabbs;
+	points.resize(BENCH_COUNT);
+	xforms.resize(BENCH_COUNT);
+	aabbs.resize(BENCH_COUNT);
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+		points[i] = random_vector(rng);
+		xforms[i] = random_transform(rng);
+		aabbs[i] = random_aabb(rng);
+	}
+	LocalVector<Vector3> out_points;
+	LocalVector<Transform3D> out_xforms;
+	LocalVector<AABB> out_aabbs;
+	LocalVector<uint8_t> out_inside;
+	out_points.resize(BENCH_COUNT);
+	out_xforms.resize(BENCH_COUNT);
+	out_aabbs.resize(BENCH_COUNT);
+	out_inside.resize(BENCH_COUNT);
+	Vector<Plane> planes = Projection::create_perspective(75, 1.5, 0.05, 100).get_projection_planes(xform);
+
+	OS *os = OS::get_singleton();
+	uint64_t t0, t1, t2;
+
+	t0 = os->get_ticks_usec();
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+		out_points[i] = xform.xform(points[i]);
+	}
+	t1 = os->get_ticks_usec();
+	MathBatch::xform_points(xform, points.ptr(), out_points.ptr(), BENCH_COUNT);
+	t2 = os->get_ticks_usec();
+	MESSAGE(vformat("xform_points: %d usec per-element, %d usec batched.", t1 - t0, t2 - t1));
+
+	t0 = os->get_ticks_usec();
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+		out_xforms[i] = xform * xforms[i];
+	}
+	t1 = os->get_ticks_usec();
+	MathBatch::compose_transforms(xform, xforms.ptr(), out_xforms.ptr(), BENCH_COUNT);
+	t2 = os->get_ticks_usec();
+	MESSAGE(vformat("compose_transforms: %d usec per-element, %d usec batched.", t1 - t0, t2 - t1));
+
+	t0 = os->get_ticks_usec();
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+		out_aabbs[i] = xform.xform(aabbs[i]);
+	}
+	t1 = os->get_ticks_usec();
+	MathBatch::xform_aabbs(xform, aabbs.ptr(), out_aabbs.ptr(), BENCH_COUNT);
+	t2 = os->get_ticks_usec();
+	MESSAGE(vformat("xform_aabbs: %d usec per-element, %d usec batched.", t1 - t0, t2 - t1));
+
+	t0 = os->get_ticks_usec();
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+		out_inside[i] = aabbs[i].intersects_convex_shape(planes.ptr(), planes.size(), nullptr, 0);
+	}
+	t1 = os->get_ticks_usec();
+	MathBatch::frustum_test_aabbs(planes.ptr(), planes.size(), aabbs.ptr(), BENCH_COUNT, out_inside.ptr());
+	t2 = os->get_ticks_usec();
+	MESSAGE(vformat("frustum_test_aabbs: %d usec per-element, %d usec batched.", t1 - t0, t2 - t1));
+}
+
+// Run it in both a regular and a `precision=double` build to compare them.
+TEST_CASE("[MathBatch][Benchmark] Cull a million instances in a large world" * doctest::skip()) {
+	constexpr uint32_t INSTANCE_COUNT = 1000000;
+	constexpr int FRAME_COUNT = 10;
+	// Far enough from the origin for single precision to lose centimeters.
+	const Vector3 world_offset = Vector3(1000000, 0, -2000000);
+
+	// Instances spread over a 2 km square around the camera, stored the way RendererSceneCull stores them.
+	RandomPCG rng(7);
+	LocalVector<AABB> aabbs;
+	LocalVector<float> bounds;
+	aabbs.resize(INSTANCE_COUNT);
+	bounds.resize(INSTANCE_COUNT * 6);
+	for (uint32_t i = 0; i < INSTANCE_COUNT; i++) {
+		const Vector3 position = world_offset + Vector3(rng.random(-1000.0f, 1000.0f), rng.random(-10.0f, 50.0f), rng.random(-1000.0f, 1000.0f));
+		aabbs[i] = AABB(position, Vector3(rng.random(0.5f, 4.0f), rng.random(0.5f, 8.0f), rng.random(0.5f, 4.0f)));
+		MathBatch::store_bounds(aabbs[i], &bounds[i * 6]);
+	}
+	LocalVector<uint8_t> inside;
+	inside.resize(INSTANCE_COUNT);
+
+	uint64_t per_instance_usec = 0;
+	uint64_t aabbs_usec = 0;
+	uint64_t bounds_usec = 0;
+	uint64_t visible = 0;
+	for (int frame = 0; frame < FRAME_COUNT; frame++) {
+		const Transform3D camera = Transform3D(Basis(Vector3(0, 1, 0), frame * Math_TAU / FRAME_COUNT), world_offset + Vector3(0, 2, 0));
+		const Vector<Plane> planes = Projection::create_perspective(75, 16.0 / 9.0, 0.05, 4000).get_projection_planes(camera);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < INSTANCE_COUNT; i++) {
+			inside[i] = aabbs[i].intersects_convex_shape(planes.ptr(), planes.size(), nullptr, 0);
+		}
+		per_instance_usec += OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		MathBatch::frustum_test_aabbs(planes.ptr(), planes.size(), aabbs.ptr(), INSTANCE_COUNT, inside.ptr(), camera.origin);
+		aabbs_usec += OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		MathBatch::frustum_test_bounds(planes.ptr(), planes.size(), bounds.ptr(), INSTANCE_COUNT, inside.ptr(), camera.origin);
+		bounds_usec += OS::get_singleton()->get_ticks_usec() - begin;
+
+		for (uint32_t i = 0; i < INSTANCE_COUNT; i++) {
+			visible += inside[i];
+		}
+	}
+
+#ifdef REAL_T_IS_DOUBLE
+	const char *precision = "double";
+#else
+	const char *precision = "single";
+#endif
+	MESSAGE(vformat("%d instances, %s precision build: per-instance AABB test %d usec, batched AABBs %d usec, batched float bounds %d usec per frame (%d visible on average).",
+			INSTANCE_COUNT, precision, (int64_t)(per_instance_usec / FRAME_COUNT), (int64_t)(aabbs_usec / FRAME_COUNT), (int64_t)(bounds_usec / FRAME_COUNT), (int64_t)(visible / FRAME_COUNT)));
+	CHECK(visible > 0);
+}
+
+} // namespace TestMathBatch
+
+namespace TestPackedArray {
+
+TEST_CASE("[PackedArray][Benchmark] Bulk arithmetic versus per-element loop" * doctest::skip()) {
+	constexpr int SIZE = 1000000;
+
+	PackedFloat32Array values;
+	values.resize(SIZE);
+	for (int i = 0; i < SIZE; i++) {
+		values.set(i, i * 0.001f);
+	}
+
+	// What a script loop does for `for i in size: array[i] = array[i] * factor + value`.
+	{
+		Variant array = values.duplicate();
+		const Variant factor = 1.5;
+		const Variant value = 2.0;
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < SIZE; i++) {
+			bool valid = false;
+			bool oob = false;
+			const Variant element = array.get_indexed(i, valid, oob);
+			Variant scaled;
+			Variant::evaluate(Variant::OP_MULTIPLY, element, factor, scaled, valid);
+			Variant result;
+			Variant::evaluate(Variant::OP_ADD, scaled, value, result, valid);
+			array.set_indexed(i, result, valid, oob);
+		}
+		MESSAGE(vformat("Per-element multiply-add of %d floats: %d usec.", SIZE, int64_t(OS::get_singleton()->get_ticks_usec() - begin)));
+	}
+
+	{
+		Variant array = values.duplicate();
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		array.call("multiply_add", 1.5, 2.0);
+		MESSAGE(vformat("Bulk multiply_add of %d floats: %d usec.", SIZE, int64_t(OS::get_singleton()->get_ticks_usec() - begin)));
+	}
+
+	{
+		const Variant array = values;
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		double sum = 0.0;
+		for (int i = 0; i < SIZE; i++) {
+			bool valid = false;
+			bool oob = false;
+			sum += double(array.get_indexed(i, valid, oob));
+		}
+		MESSAGE(vformat("Per-element sum of %d floats: %d usec (%f).", SIZE, int64_t(OS::get_singleton()->get_ticks_usec() - begin), sum));
+	}
+
+	{
+		Variant array = values;
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		const double sum = array.call("sum");
+		MESSAGE(vformat("Bulk sum of %d floats: %d usec (%f).", SIZE, int64_t(OS::get_singleton()->get_ticks_usec() - begin), sum));
+	}
+}
+
+} // namespace TestPackedArray
+
+namespace TestObject {
+
+TEST_CASE("[Object][Benchmark] Multithreaded ObjectDB lookups" * doctest::skip()) {
+	constexpr uint32_t OBJECT_COUNT = 10000;
+	constexpr uint32_t LOOKUPS_PER_THREAD = 10000000;
+
+	struct LookupBenchmark {
+		LocalVector<ObjectID> ids;
+		std::atomic<uint64_t> found = 0;
+	} bench;
+
+	LocalVector<Object *> objects;
+	for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+		objects.push_back(memnew(Object));
+		bench.ids.push_back(objects[i]->get_instance_id());
+	}
+
+	const uint32_t max_threads = OS::get_singleton()->get_processor_count();
+	for (uint32_t thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+		TightLocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (Thread &thread : threads) {
+			thread.start(
+					[](void *p_data) {
+						LookupBenchmark *lb = (LookupBenchmark *)p_data;
+						uint64_t local_found = 0;
+						for (uint32_t i = 0; i < LOOKUPS_PER_THREAD; i++) {
+							local_found += ObjectDB::get_instance(lb->ids[i % lb->ids.size()]) != nullptr;
+						}
+						lb->found.fetch_add(local_found, std::memory_order_relaxed);
+					},
+					&bench);
+		}
+		for (Thread &thread : threads) {
+			thread.wait_to_finish();
+		}
+		uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE(vformat("%d threads: %d lookups in %d usec (%.1f M lookups/s).", thread_count, uint64_t(thread_count) * LOOKUPS_PER_THREAD, elapsed, double(thread_count) * LOOKUPS_PER_THREAD / MAX(elapsed, uint64_t(1))));
+	}
+
+	CHECK(bench.found.load() > 0);
+
+	for (Object *object : objects) {
+		memdelete(object);
+	}
+}
+
+} // namespace TestObject
+
+namespace TestNode {
+
+// Times duplicate() on the subtree, and instantiating a PackedScene packed from it.
+static void compare_duplicate_with_instantiate(Node *p_root, int p_node_count) {
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Node *copy = p_root->duplicate();
+	const uint64_t duplicate_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	Ref<PackedScene> scene;
+	scene.instantiate();
+	scene->pack(p_root);
+	begin = OS::get_singleton()->get_ticks_usec();
+	Node *instance = scene->instantiate();
+	const uint64_t instantiate_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d nodes, duplicate(): %d usec, PackedScene.instantiate(): %d usec.", p_node_count, duplicate_usec, instantiate_usec));
+	CHECK_EQ(copy->get_child_count(), p_root->get_child_count());
+
+	memdelete(instance);
+	memdelete(copy);
+}
+
+TEST_CASE("[SceneTree][Node][Benchmark] Batched processing of many nodes" * doctest::skip()) {
+	constexpr int NODE_COUNT = 50000;
+	constexpr int FRAME_COUNT = 100;
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	Node *crowd = memnew(Node);
+	for (int i = 0; i < NODE_COUNT; i++) {
+		BatchedTestNode *agent = memnew(BatchedTestNode);
+		agent->set_process(true);
+		crowd->add_child(agent);
+	}
+	root->add_child(crowd);
+
+	for (int batched = 0; batched < 2; batched++) {
+		for (int i = 0; i < NODE_COUNT; i++) {
+			crowd->get_child(i)->set_process_batched(batched);
+		}
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int frame = 0; frame < FRAME_COUNT; frame++) {
+			SceneTree::get_singleton()->process(0);
+		}
+		const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+		MESSAGE(vformat("Processing %d nodes %s for %d frames: %d usec.", NODE_COUNT, batched ? "in batches" : "one by one", FRAME_COUNT, usec));
+	}
+
+	memdelete(crowd);
+}
+
+TEST_CASE("[SceneTree][Node][Benchmark] Churn in a large group" * doctest::skip()) {
+	constexpr int NODE_COUNT = 5000;
+	constexpr int CHURN_PER_FRAME = 50;
+	constexpr int QUERIES_PER_FRAME = 20;
+	constexpr int FRAME_COUNT = 100;
+
+	Node *parent = memnew(Node);
+	for (int i = 0; i < NODE_COUNT; i++) {
+		Node *node = memnew(Node);
+		node->add_to_group("enemies");
+		parent->add_child(node);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	RandomPCG rng(1);
+	int64_t visited = 0;
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int frame = 0; frame < FRAME_COUNT; frame++) {
+		for (int i = 0; i < CHURN_PER_FRAME; i++) {
+			parent->get_child(rng.random(0, NODE_COUNT - 1))->remove_from_group("enemies");
+			parent->get_child(rng.random(0, NODE_COUNT - 1))->add_to_group("enemies");
+		}
+		for (int i = 0; i < QUERIES_PER_FRAME; i++) {
+			visited += SceneTree::get_singleton()->get_nodes_in_group_view("enemies").size();
+		}
+	}
+	const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d frames of %d group changes and %d queries on %d nodes: %d usec (%d nodes visited).", FRAME_COUNT, CHURN_PER_FRAME * 2, QUERIES_PER_FRAME, NODE_COUNT, usec, visited));
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node][Benchmark] Add and remove a large subtree" * doctest::skip()) {
+	constexpr int CHUNK_NODE_COUNT = 10000;
+	Window *root = SceneTree::get_singleton()->get_root();
+
+	// Nodes already in the level, sharing groups and process lists with the chunk.
+	Node *level = memnew(Node);
+	for (int i = 0; i < CHUNK_NODE_COUNT; i++) {
+		Node *node = memnew(Node);
+		node->add_to_group("units");
+		node->set_process(true);
+		level->add_child(node);
+	}
+	root->add_child(level);
+
+	Node *chunk = memnew(Node);
+	for (int i = 0; i < CHUNK_NODE_COUNT / 100; i++) {
+		Node *parent = memnew(Node);
+		chunk->add_child(parent);
+		for (int j = 1; j < 100; j++) {
+			Node *node = memnew(Node);
+			node->add_to_group("units");
+			node->add_to_group("chunk");
+			node->set_process(true);
+			parent->add_child(node);
+		}
+	}
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	root->add_child(chunk);
+	const uint64_t add_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	root->remove_child(chunk);
+	const uint64_t remove_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Adding a %d node subtree: %d usec, removing it: %d usec.", CHUNK_NODE_COUNT, add_usec, remove_usec));
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("units"), CHUNK_NODE_COUNT);
+
+	memdelete(chunk);
+	memdelete(level);
+}
+
+TEST_CASE("[SceneTree][Node][Benchmark] Node path cache" * doctest::skip()) {
+	constexpr int DEPTH = 8;
+	constexpr int LOOKUP_COUNT = 1000000;
+
+	Node *scene = memnew(Node);
+	Node *parent = scene;
+	String path;
+	for (int i = 0; i < DEPTH; i++) {
+		Node *node = memnew(Node);
+		node->set_name(vformat("Level%d", i));
+		parent->add_child(node);
+		path = path.is_empty() ? String(node->get_name()) : path + "/" + node->get_name();
+		parent = node;
+	}
+	Node *caller = memnew(Node);
+	scene->add_child(caller);
+	SceneTree::get_singleton()->get_root()->add_child(scene);
+
+	const NodePath node_path = NodePath("../" + path);
+	for (int pass = 0; pass < 2; pass++) {
+		caller->set_cache_node_paths(pass == 1);
+		int found = 0;
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < LOOKUP_COUNT; i++) {
+			found += caller->get_node_or_null(node_path) == parent;
+		}
+		const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+		CHECK_EQ(found, LOOKUP_COUNT);
+		MESSAGE(vformat("%d lookups of a %d level path %s cache: %d usec.", LOOKUP_COUNT, DEPTH, pass == 1 ? "with" : "without", usec));
+	}
+
+	memdelete(scene);
+}
+
+} // namespace TestNode
+
+namespace TestNode2D {
+
+TEST_CASE("[SceneTree][Node2D][Benchmark] Duplicate a large subtree" * doctest::skip()) {
+	constexpr int BRANCH_COUNT = 100;
+	constexpr int BRANCH_SIZE = 100;
+
+	Node2D *root = memnew(Node2D);
+	for (int i = 0; i < BRANCH_COUNT; i++) {
+		Node2D *branch = memnew(Node2D);
+		branch->set_position(Point2(i, 0));
+		root->add_child(branch);
+		branch->set_owner(root);
+		for (int j = 0; j < BRANCH_SIZE; j++) {
+			Node2D *node = memnew(Node2D);
+			node->set_position(Point2(0, j));
+			node->set_modulate(Color(1, 1, 1, 0.5));
+			branch->add_child(node);
+			node->set_owner(root);
+		}
+	}
+
+	TestNode::compare_duplicate_with_instantiate(root, BRANCH_COUNT * (BRANCH_SIZE + 1) + 1);
+	memdelete(root);
+}
+
+} // namespace TestNode2D
+
+namespace TestControl {
+
+TEST_CASE("[SceneTree][Control][Benchmark] Duplicate a large subtree" * doctest::skip()) {
+	constexpr int BRANCH_COUNT = 100;
+	constexpr int BRANCH_SIZE = 100;
+
+	Control *root = memnew(Control);
+	root->set_anchors_and_offsets_preset(Control::PRESET_FULL_RECT);
+	for (int i = 0; i < BRANCH_COUNT; i++) {
+		Control *branch = memnew(Control);
+		branch->set_position(Point2(i, 0));
+		root->add_child(branch);
+		branch->set_owner(root);
+		for (int j = 0; j < BRANCH_SIZE; j++) {
+			Control *node = memnew(Control);
+			node->set_anchors_and_offsets_preset(Control::PRESET_TOP_WIDE);
+			node->set_custom_minimum_size(Size2(0, j));
+			node->set_mouse_filter(Control::MOUSE_FILTER_IGNORE);
+			branch->add_child(node);
+			node->set_owner(root);
+		}
+	}
+
+	TestNode::compare_duplicate_with_instantiate(root, BRANCH_COUNT * (BRANCH_SIZE + 1) + 1);
+	memdelete(root);
+}
+
+} // namespace TestControl
+
+namespace TestPackedScene {
+
+TEST_CASE("[PackedScene][Benchmark] Instantiate a large scene" * doctest::skip()) {
+	constexpr int NODE_COUNT = 500;
+	constexpr int INSTANCE_COUNT = 1000;
+
+	Node *root = memnew(Node);
+	root->set_name("Root");
+	for (int i = 1; i < NODE_COUNT; i++) {
+		Node2D *node = memnew(Node2D);
+		node->set_name(vformat("Node%d", i));
+		node->set_position(Vector2(i, -i));
+		node->set_rotation(i * 0.01);
+		node->set_z_index(i % 10);
+		node->add_to_group("benchmark", true);
+		root->add_child(node);
+		node->set_owner(root);
+	}
+
+	PackedScene packed_scene;
+	CHECK(packed_scene.pack(root) == OK);
+	memdelete(root);
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < INSTANCE_COUNT; i++) {
+		Node *instance = packed_scene.instantiate();
+		memdelete(instance);
+	}
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Instantiated and freed a %d node scene %d times in %d usec (%.1f usec per instance).", NODE_COUNT, INSTANCE_COUNT, elapsed, double(elapsed) / INSTANCE_COUNT));
+}
+
+TEST_CASE("[SceneTree][PackedScene][Benchmark] Pooled spawn and despawn throughput" * doctest::skip()) {
+	constexpr int SPAWN_COUNT = 100;
+	constexpr int FRAME_COUNT = 1000;
+
+	Ref<PackedScene> packed_scene = _make_pooled_test_scene();
+	Window *root = SceneTree::get_singleton()->get_root();
+	LocalVector<Node *> spawned;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int frame = 0; frame < FRAME_COUNT; frame++) {
+		for (int i = 0; i < SPAWN_COUNT; i++) {
+			Node *instance = packed_scene->instantiate();
+			root->add_child(instance);
+			spawned.push_back(instance);
+		}
+		for (Node *instance : spawned) {
+			instance->queue_free();
+		}
+		spawned.clear();
+		SceneTree::get_singleton()->process(0);
+	}
+	const uint64_t instantiate_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	packed_scene->set_pool_max_size(SPAWN_COUNT);
+	packed_scene->prewarm(SPAWN_COUNT);
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int frame = 0; frame < FRAME_COUNT; frame++) {
+		for (int i = 0; i < SPAWN_COUNT; i++) {
+			Node *instance = packed_scene->instantiate_pooled();
+			root->add_child(instance);
+			spawned.push_back(instance);
+		}
+		for (Node *instance : spawned) {
+			packed_scene->release_instance(instance);
+		}
+		spawned.clear();
+		SceneTree::get_singleton()->process(0);
+	}
+	const uint64_t pooled_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("instantiate() + queue_free(): %d usec, instantiate_pooled() + release_instance(): %d usec (%.2fx).", instantiate_usec, pooled_usec, double(instantiate_usec) / MAX(pooled_usec, uint64_t(1))));
+	CHECK(packed_scene->get_pooled_count() == SPAWN_COUNT);
+
+	packed_scene->clear_pool();
+}
+
+} // namespace TestPackedScene
+
+#ifndef PHYSICS_2D_DISABLED
+namespace TestPhysicsServer2D {
+
+TEST_CASE("[SceneTree][PhysicsServer2D][Benchmark] Space state snapshots" * doctest::skip()) {
+	constexpr int BODY_COUNT = 2000;
+	constexpr int SETTLE_STEPS = 60;
+	constexpr int ITERATIONS = 100;
+
+	DeterministicSpaces deterministic;
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(floor_shape, Vector2(5000, 10));
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(10, 10));
+	LocalVector<RID> bodies;
+	create_box_pile(space, floor_shape, box_shape, BODY_COUNT, bodies);
+
+	TestPhysicsServerUtils::step_spaces(ps, SETTLE_STEPS);
+
+	Vector<uint8_t> state;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ITERATIONS; i++) {
+		state = ps->space_save_state(space);
+	}
+	const uint64_t save_usec = (OS::get_singleton()->get_ticks_usec() - begin) / ITERATIONS;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ITERATIONS; i++) {
+		ps->space_restore_state(space, state);
+	}
+	const uint64_t restore_usec = (OS::get_singleton()->get_ticks_usec() - begin) / ITERATIONS;
+
+	const uint64_t step_usec = TestPhysicsServerUtils::step_spaces(ps, ITERATIONS);
+
+	MESSAGE(vformat("%d dynamic bodies: %d bytes per state, %d usec to save, %d usec to restore, %d usec per step.", BODY_COUNT, state.size(), (int64_t)save_usec, (int64_t)restore_usec, (int64_t)step_usec));
+
+	// Resimulate with a different number of threads, as a rollback on another machine would.
+	LocalVector<LocalVector<Variant>> states;
+	REQUIRE_EQ(ps->space_restore_state(space, state), OK);
+	for (int i = 0; i < SETTLE_STEPS; i++) {
+		ps->step(1.0 / 60.0);
+		states.push_back(get_body_states(bodies));
+	}
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (int thread_count = 1; thread_count <= 4; thread_count *= 2) {
+		pool->finish();
+		pool->init(thread_count);
+		REQUIRE_EQ(ps->space_restore_state(space, state), OK);
+		for (int i = 0; i < SETTLE_STEPS; i++) {
+			ps->step(1.0 / 60.0);
+			CHECK_MESSAGE(TestPhysicsServerUtils::body_states_match(get_body_states(bodies), states[i]), vformat("Step %d differs with %d threads.", i, thread_count));
+		}
+	}
+	pool->finish();
+	pool->init();
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+} // namespace TestPhysicsServer2D
+#endif // PHYSICS_2D_DISABLED
+
+#ifndef _3D_DISABLED
+namespace TestNode3D {
+
+TEST_CASE("[SceneTree][Node3D][Benchmark] Move every node of deep hierarchies" * doctest::skip()) {
+	constexpr int CHAIN_COUNT = 100;
+	constexpr int CHAIN_DEPTH = 50;
+	constexpr int FRAME_COUNT = 100;
+	SceneTree *tree = SceneTree::get_singleton();
+
+	Node3D *root = memnew(Node3D);
+	LocalVector<Node3D *> nodes;
+	for (int i = 0; i < CHAIN_COUNT; i++) {
+		Node3D *parent = root;
+		for (int j = 0; j < CHAIN_DEPTH; j++) {
+			Node3D *node = memnew(TransformNotifyNode3D);
+			parent->add_child(node);
+			nodes.push_back(node);
+			parent = node;
+		}
+	}
+	tree->get_root()->add_child(root);
+	tree->flush_transform_notifications();
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int frame = 0; frame < FRAME_COUNT; frame++) {
+		// Parents first, like animated skeletons and attachments do.
+		for (Node3D *node : nodes) {
+			node->set_position(Vector3(frame + 1, 0, 0));
+		}
+		tree->flush_transform_notifications();
+	}
+	const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Moving %d nodes in chains of %d for %d frames: %d usec.", CHAIN_COUNT * CHAIN_DEPTH, CHAIN_DEPTH, FRAME_COUNT, usec));
+	CHECK_EQ(Object::cast_to<TransformNotifyNode3D>(nodes[CHAIN_DEPTH - 1])->transform_changed_count, FRAME_COUNT);
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D][Benchmark] Duplicate a large subtree" * doctest::skip()) {
+	constexpr int BRANCH_COUNT = 100;
+	constexpr int BRANCH_SIZE = 100;
+
+	Node3D *root = memnew(Node3D);
+	for (int i = 0; i < BRANCH_COUNT; i++) {
+		Node3D *branch = memnew(Node3D);
+		branch->set_position(Vector3(i, 0, 0));
+		root->add_child(branch);
+		branch->set_owner(root);
+		for (int j = 0; j < BRANCH_SIZE; j++) {
+			Node3D *node = memnew(Node3D);
+			node->set_position(Vector3(0, j, 0));
+			branch->add_child(node);
+			node->set_owner(root);
+		}
+	}
+
+	TestNode::compare_duplicate_with_instantiate(root, BRANCH_COUNT * (BRANCH_SIZE + 1) + 1);
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#ifndef PHYSICS_3D_DISABLED
+namespace TestPhysicsServer3D {
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Batched ray queries" * doctest::skip()) {
+	constexpr int BOX_COUNT = 1000;
+	constexpr int RAY_COUNT = 50000;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID shape = ps->box_shape_create();
+	ps->shape_set_data(shape, Vector3(1, 1, 1));
+	LocalVector<RID> bodies;
+	create_box_row(space, shape, BOX_COUNT, bodies);
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	REQUIRE(state);
+
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	for (int i = 0; i < RAY_COUNT; i++) {
+		const real_t x = Math::fmod(i * 0.37, BOX_COUNT * 4.0);
+		from.push_back(Vector3(x, 0, -10));
+		to.push_back(Vector3(x + 3, 0, 10));
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(RAY_COUNT);
+	LocalVector<bool> hits;
+	hits.resize(RAY_COUNT);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < RAY_COUNT; i++) {
+		parameters.from = from[i];
+		parameters.to = to[i];
+		hits[i] = state->intersect_ray(parameters, results[i]);
+	}
+	const uint64_t single_usec = MAX<uint64_t>(OS::get_singleton()->get_ticks_usec() - begin, 1);
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	state->intersect_rays(parameters, from.ptr(), to.ptr(), RAY_COUNT, results.ptr(), hits.ptr());
+	const uint64_t batched_usec = MAX<uint64_t>(OS::get_singleton()->get_ticks_usec() - begin, 1);
+
+	MESSAGE(vformat("%d rays against %d boxes, single queries: %d rays/sec, batched: %d rays/sec.", RAY_COUNT, BOX_COUNT, (int64_t)(RAY_COUNT * 1000000ULL / single_usec), (int64_t)(RAY_COUNT * 1000000ULL / batched_usec)));
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Step time by thread count" * doctest::skip()) {
+	constexpr int BODY_COUNT = 10000;
+	constexpr int WARMUP_STEPS = 10;
+	constexpr int STEP_COUNT = 60;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(500, 1, 500));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+	LocalVector<RID> bodies;
+	create_box_pile(space, floor_shape, box_shape, BODY_COUNT, bodies);
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	for (int thread_count = 1; thread_count <= 16; thread_count *= 2) {
+		pool->finish();
+		pool->init(thread_count);
+
+		TestPhysicsServerUtils::step_spaces(ps, WARMUP_STEPS);
+		const uint64_t step_usec = TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+
+		MESSAGE(vformat("%d dynamic bodies, %d threads: %d usec per step, %d collision pairs.", BODY_COUNT, thread_count, (int64_t)step_usec, ps->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS)));
+	}
+	pool->finish();
+	pool->init();
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Space state rollback" * doctest::skip()) {
+	constexpr int BODY_COUNT = 2000;
+	constexpr int SETTLE_STEPS = 60;
+	constexpr int RESIMULATED_STEPS = 10;
+	constexpr int ITERATIONS = 20;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(500, 1, 500));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(1, 1, 1));
+	LocalVector<RID> bodies;
+	create_box_pile(space, floor_shape, box_shape, BODY_COUNT, bodies);
+
+	TestPhysicsServerUtils::step_spaces(ps, SETTLE_STEPS);
+
+	uint64_t save_usec = 0;
+	uint64_t restore_usec = 0;
+	uint64_t step_usec = 0;
+	Vector<uint8_t> state;
+	for (int i = 0; i < ITERATIONS; i++) {
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		state = ps->space_save_state(space);
+		save_usec += OS::get_singleton()->get_ticks_usec() - begin;
+
+		TestPhysicsServerUtils::step_spaces(ps, RESIMULATED_STEPS);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		ps->space_restore_state(space, state);
+		restore_usec += OS::get_singleton()->get_ticks_usec() - begin;
+
+		step_usec += TestPhysicsServerUtils::step_spaces(ps, RESIMULATED_STEPS) * RESIMULATED_STEPS;
+	}
+
+	MESSAGE(vformat("%d dynamic bodies: %d bytes per state, %d usec to save, %d usec to restore, %d usec to resimulate %d steps.", BODY_COUNT, state.size(), (int64_t)(save_usec / ITERATIONS), (int64_t)(restore_usec / ITERATIONS), (int64_t)(step_usec / ITERATIONS), RESIMULATED_STEPS));
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Active regions" * doctest::skip()) {
+	constexpr int BODY_COUNT = 100000;
+	constexpr real_t SPACING = 4.0;
+	// Fraction of the bodies inside the active region, as when only the surroundings of players need to be simulated.
+	constexpr real_t ACTIVE_FRACTION = 0.05;
+	constexpr int STEP_COUNT = 60;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	const int side = Math::ceil(Math::sqrt((double)BODY_COUNT));
+	const real_t half_size = side * SPACING * 0.5;
+	RID floor_shape = ps->box_shape_create();
+	ps->shape_set_data(floor_shape, Vector3(half_size + 10, 1, half_size + 10));
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	bodies.push_back(create_static_body(space, floor_shape));
+
+	// Frictionless boxes sliding around keep every island awake for the whole benchmark.
+	for (int i = 0; i < BODY_COUNT; i++) {
+		const Vector3 origin = Vector3((i % side) * SPACING - half_size, 1.5, (i / side) * SPACING - half_size);
+		RID body = create_rigid_body(space, box_shape, Transform3D(Basis(), origin));
+		ps->body_set_param(body, PhysicsServer3D::BODY_PARAM_FRICTION, 0.0);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(Math::sin((real_t)i), 0, Math::cos((real_t)i)) * 2);
+		bodies.push_back(body);
+	}
+
+	for (int pass = 0; pass < 2; pass++) {
+		Vector<AABB> regions;
+		if (pass == 1) {
+			const real_t region_half_size = half_size * Math::sqrt(ACTIVE_FRACTION);
+			regions.push_back(AABB(Vector3(-region_half_size, -10, -region_half_size), Vector3(region_half_size * 2, 20, region_half_size * 2)));
+		}
+		ps->space_set_active_regions(space, regions);
+		ps->step(1.0 / 60.0);
+
+		const uint64_t step_usec = TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+
+		MESSAGE(vformat("%d bodies, %s: %d usec per step, %d active objects.", BODY_COUNT, pass == 0 ? "whole space simulated" : "active region", (int64_t)step_usec, ps->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS)));
+	}
+
+	TestPhysicsServerUtils::free_rids(ps, bodies);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Continuous collision detection" * doctest::skip()) {
+	constexpr int SIDE = 32;
+	constexpr real_t SPEED = 100.0;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	RID wall_shape = ps->box_shape_create();
+	ps->shape_set_data(wall_shape, Vector3(0.025, SIDE * 2, SIDE * 2));
+
+	// At 30 Hz, boxes move more than their size plus the wall's thickness every step.
+	const int tick_rates[3] = { 120, 30, 30 };
+	const bool continuous_cd[3] = { false, false, true };
+	for (int run = 0; run < 3; run++) {
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+		RID wall = create_static_body(space, wall_shape);
+
+		LocalVector<RID> bodies;
+		for (int i = 0; i < SIDE * SIDE; i++) {
+			const Vector3 origin = Vector3(-20, (i % SIDE) * 3 - SIDE * 1.5, (i / SIDE) * 3 - SIDE * 1.5);
+			bodies.push_back(create_projectile(space, box_shape, origin, Vector3(SPEED, 0, 0), continuous_cd[run]));
+		}
+
+		// Simulate one second.
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < tick_rates[run]; i++) {
+			ps->step(1.0 / tick_rates[run]);
+		}
+		const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+		int tunneled = 0;
+		for (const RID &body : bodies) {
+			if (Transform3D(ps->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x > 0) {
+				tunneled++;
+			}
+			ps->free(body);
+		}
+		ps->free(wall);
+		ps->free(space);
+
+		MESSAGE(vformat("%d Hz, continuous collision detection %s: %d usec per simulated second, %d of %d bodies tunneled.", tick_rates[run], continuous_cd[run] ? "on" : "off", (int64_t)usec, tunneled, SIDE * SIDE));
+	}
+
+	ps->free(wall_shape);
+	ps->free(box_shape);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Large heightmap" * doctest::skip()) {
+	constexpr int SIZE = 4096;
+	constexpr int QUERY_COUNT = 100000;
+	const Vector<real_t> heights = create_terrain_heights(SIZE, SIZE);
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	// The shape data is freed before measuring, so the difference is only what the shape keeps.
+	const uint64_t memory_before = Memory::get_mem_usage();
+	RID shape = ps->heightmap_shape_create();
+	{
+		Dictionary data;
+		data["width"] = SIZE;
+		data["depth"] = SIZE;
+		data["heights"] = heights;
+		ps->shape_set_data(shape, data);
+	}
+	const uint64_t shape_memory = Memory::get_mem_usage() - memory_before;
+	RID body = create_static_body(space, shape);
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	REQUIRE(state);
+
+	const real_t half_size = (SIZE - 1) * 0.5;
+	PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+	PhysicsDirectSpaceState3D::RayResult ray_result;
+	int hit_count = 0;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < QUERY_COUNT; i++) {
+		const real_t x = Math::fmod(i * 37.3, SIZE - 1.0) - half_size;
+		const real_t z = Math::fmod(i * 91.7, SIZE - 1.0) - half_size;
+		ray_parameters.from = Vector3(x, 50, z);
+		ray_parameters.to = Vector3(x + 200, -50, z + 100);
+		hit_count += state->intersect_ray(ray_parameters, ray_result) ? 1 : 0;
+	}
+	const uint64_t ray_usec = MAX<uint64_t>(OS::get_singleton()->get_ticks_usec() - begin, 1);
+
+	RID query_shape = ps->sphere_shape_create();
+	ps->shape_set_data(query_shape, 2.0);
+	PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+	shape_parameters.shape_rid = query_shape;
+	PhysicsDirectSpaceState3D::ShapeResult shape_results[4];
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < QUERY_COUNT; i++) {
+		const real_t x = Math::fmod(i * 37.3, SIZE - 1.0) - half_size;
+		const real_t z = Math::fmod(i * 91.7, SIZE - 1.0) - half_size;
+		shape_parameters.transform = Transform3D(Basis(), Vector3(x, 1, z));
+		state->intersect_shape(shape_parameters, shape_results, 4);
+	}
+	const uint64_t shape_usec = MAX<uint64_t>(OS::get_singleton()->get_ticks_usec() - begin, 1);
+
+	MESSAGE(vformat("%dx%d heightmap: %d KiB (%d KiB of raw heights).", SIZE, SIZE, (int64_t)(shape_memory / 1024), (int64_t)(heights.size() * sizeof(real_t) / 1024)));
+	MESSAGE(vformat("%d rays/sec (%d hits), %d shape queries/sec.", (int64_t)(QUERY_COUNT * 1000000ULL / ray_usec), hit_count, (int64_t)(QUERY_COUNT * 1000000ULL / shape_usec)));
+
+	ps->free(query_shape);
+	ps->free(body);
+	ps->free(shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D][Benchmark] Soft bodies by thread count" * doctest::skip()) {
+	constexpr int WARMUP_STEPS = 10;
+	constexpr int STEP_COUNT = 60;
+
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	// Many cloths of about 2k vertices, solved in parallel with each other, then a single large one, solved by link color.
+	const int cloth_sizes[2] = { 45, 72 };
+	const int cloth_counts[2] = { 50, 1 };
+	for (int setup = 0; setup < 2; setup++) {
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+		RID mesh = create_cloth_mesh(cloth_sizes[setup]);
+		LocalVector<RID> bodies;
+		create_cloths(space, mesh, cloth_sizes[setup], cloth_counts[setup], bodies);
+
+		for (int thread_count = 1; thread_count <= 16; thread_count *= 2) {
+			pool->finish();
+			pool->init(thread_count);
+
+			TestPhysicsServerUtils::step_spaces(ps, WARMUP_STEPS);
+			const uint64_t step_usec = TestPhysicsServerUtils::step_spaces(ps, STEP_COUNT);
+
+			MESSAGE(vformat("%d cloths of %d vertices, %d threads: %d usec per step.", cloth_counts[setup], cloth_sizes[setup] * cloth_sizes[setup], thread_count, (int64_t)step_usec));
+		}
+
+		TestPhysicsServerUtils::free_rids(ps, bodies);
+		RS::get_singleton()->free(mesh);
+		ps->free(space);
+	}
+	pool->finish();
+	pool->init();
+}
+
+} // namespace TestPhysicsServer3D
+#endif // PHYSICS_3D_DISABLED
+#endif // _3D_DISABLED
@@ -64,10 +64,12 @@
 #include "tests/core/math/test_aabb.h"
 #include "tests/core/math/test_astar.h"
 #include "tests/core/math/test_basis.h"
+#include "tests/core/math/test_bvh.h"
 #include "tests/core/math/test_color.h"
 #include "tests/core/math/test_expression.h"
 #include "tests/core/math/test_geometry_2d.h"
 #include "tests/core/math/test_geometry_3d.h"
+#include "tests/core/math/test_math_batch.h"
 #include "tests/core/math/test_math_funcs.h"
 #include "tests/core/math/test_plane.h"
 #include "tests/core/math/test_projection.h"
@@ -112,6 +114,7 @@
 #include "tests/core/variant/test_array.h"
 #include "tests/core/variant/test_callable.h"
 #include "tests/core/variant/test_dictionary.h"
+#include "tests/core/variant/test_packed_array.h"
 #include "tests/core/variant/test_variant.h"
 #include "tests/core/variant/test_variant_utility.h"
 #include "tests/scene/test_animation.h"
@@ -170,6 +173,10 @@
 #include "tests/servers/test_navigation_server_2d.h"
 #endif // MODULE_NAVIGATION_2D_ENABLED
 
+#ifndef PHYSICS_2D_DISABLED
+#include "tests/servers/test_physics_server_2d.h"
+#endif // PHYSICS_2D_DISABLED
+
 #ifndef _3D_DISABLED
 #ifdef MODULE_NAVIGATION_3D_ENABLED
 #include "tests/scene/test_navigation_agent_3d.h"
@@ -183,7 +190,9 @@
 #include "tests/scene/test_gltf_document.h"
 #ifndef PHYSICS_3D_DISABLED
 #include "tests/scene/test_height_map_shape_3d.h"
+#include "tests/servers/test_physics_server_3d.h"
 #endif // PHYSICS_3D_DISABLED
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_path_follow_3d.h"
 #include "tests/scene/test_primitives.h"
@@ -191,6 +200,8 @@
 #include "tests/scene/test_sky.h"
 #endif // _3D_DISABLED
 
+#include "tests/test_benchmarks.h"
+
 #include "modules/modules_tests.gen.h"
 
 #include "tests/display_server_mock.h"